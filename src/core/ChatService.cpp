@@ -0,0 +1,221 @@
+#include "ChatService.hpp"
+#include "CoreManager.hpp"
+#include "player/PlayerExtension.hpp"
+
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
+
+#include <string>
+
+namespace Core
+{
+ChatService::ChatService(IPlayerPool* playerPool,
+	ITimersComponent* timersComponent, std::shared_ptr<ModeManager> modeManager,
+	std::shared_ptr<Commands::CommandManager> commandManager,
+	std::shared_ptr<RateLimiter> rateLimiter)
+	: playerPool(playerPool)
+	, modeManager(modeManager)
+	, commandManager(commandManager)
+	, rateLimiter(rateLimiter)
+{
+	playerPool->getPlayerConnectDispatcher().addEventHandler(this);
+	this->indexTimer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->refreshPositions();
+			}),
+		LOCAL_CHAT_INDEX_INTERVAL, true);
+	this->initCommands();
+}
+
+ChatService::~ChatService()
+{
+	this->indexTimer->kill();
+	playerPool->getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+void ChatService::initCommands()
+{
+	this->commandManager->addCommand(
+		"mc",
+		[this](std::reference_wrapper<IPlayer> player, std::string message)
+		{
+			if (message.empty())
+				return false;
+			this->sendMode(player, message);
+			return true;
+		},
+		Commands::CommandInfo {
+			.args = { __("message") },
+			.description = __("Send a message to the players of your mode"),
+			.category = GENERAL_COMMAND_CATEGORY,
+		});
+	this->commandManager->addCommand(
+		"rc",
+		[this](std::reference_wrapper<IPlayer> player, std::string message)
+		{
+			if (message.empty())
+				return false;
+			this->sendRoom(player, message);
+			return true;
+		},
+		Commands::CommandInfo {
+			.args = { __("message") },
+			.description = __("Send a message to the players of your room"),
+			.category = GENERAL_COMMAND_CATEGORY,
+		});
+	this->commandManager->addCommand(
+		"l",
+		[this](std::reference_wrapper<IPlayer> player, std::string message)
+		{
+			if (message.empty())
+				return false;
+			this->sendLocal(player, message);
+			return true;
+		},
+		Commands::CommandInfo {
+			.args = { __("message") },
+			.description = __("Send a message to the players around you"),
+			.category = GENERAL_COMMAND_CATEGORY,
+		});
+}
+
+void ChatService::refreshPositions()
+{
+	for (auto player : this->playerPool->players())
+		this->positions.insert(player->getID(), player->getPosition());
+}
+
+void ChatService::appendLine(
+	Utils::MessageBuilder& builder, IPlayer& player, std::string_view message)
+{
+	auto name = player.getName();
+	builder
+		.appendPrintf("{%06x}%s(%d){FFFFFF}: ", player.getColour().RGBA() >> 8,
+			std::string_view(name.data(), name.size()), player.getID())
+		.append(message);
+}
+
+Modes::ModeBase* ChatService::getMode(IPlayer& player)
+{
+	auto playerExt = Player::getPlayerExt(player);
+	if (!playerExt->isInAnyMode())
+		return nullptr;
+	return this->modeManager->getMode(playerExt->getMode());
+}
+
+void ChatService::sendGlobal(IPlayer& player, std::string_view message)
+{
+	if (!this->rateLimiter->consume(player, RateCategory::Chat))
+		return;
+	player.setChatBubble(StringView(message.data(), message.size()),
+		Colour::White(), 100.0, Milliseconds(CHAT_BUBBLE_EXPIRATION));
+
+	// the line is the same for everyone, so format it once
+	Utils::MessageBuilder builder;
+	auto playerExt = Player::getPlayerExt(player);
+	if (playerExt->isInAnyMode())
+		builder.appendPrintf("{%s}%s: ",
+			Modes::getModeColor(playerExt->getMode()),
+			Modes::getModeShortName(playerExt->getMode()));
+	appendLine(builder, player, message);
+	auto line = builder.view();
+	for (auto recipient : this->playerPool->players())
+		recipient->sendClientMessage(
+			Colour::White(), StringView(line.data(), line.size()));
+}
+
+void ChatService::sendMode(IPlayer& player, std::string_view message)
+{
+	auto mode = this->getMode(player);
+	if (!mode)
+	{
+		Player::getPlayerExt(player)->sendErrorMessage(
+			__("You are not in any mode!"));
+		return;
+	}
+	if (!this->rateLimiter->consume(player, RateCategory::ModeChat))
+		return;
+
+	Utils::MessageBuilder builder;
+	builder.appendPrintf("{%s}[%s] ", Modes::getModeColor(mode->getModeType()),
+		Modes::getModeShortName(mode->getModeType()));
+	appendLine(builder, player, message);
+	auto line = builder.view();
+	for (auto recipient : mode->getPlayers())
+		recipient->sendClientMessage(
+			Colour::White(), StringView(line.data(), line.size()));
+}
+
+void ChatService::sendRoom(IPlayer& player, std::string_view message)
+{
+	auto mode = this->getMode(player);
+	auto roomPlayers = mode ? mode->getRoomPlayers(player) : nullptr;
+	if (!roomPlayers)
+	{
+		Player::getPlayerExt(player)->sendErrorMessage(
+			__("You are not in a room!"));
+		return;
+	}
+	if (!this->rateLimiter->consume(player, RateCategory::RoomChat))
+		return;
+
+	Utils::MessageBuilder builder;
+	builder.appendPrintf("{%s}[%s room] ",
+		Modes::getModeColor(mode->getModeType()),
+		Modes::getModeShortName(mode->getModeType()));
+	appendLine(builder, player, message);
+	auto line = builder.view();
+	for (auto recipient : *roomPlayers)
+		recipient->sendClientMessage(
+			Colour::White(), StringView(line.data(), line.size()));
+}
+
+void ChatService::sendLocal(IPlayer& player, std::string_view message)
+{
+	if (!this->rateLimiter->consume(player, RateCategory::LocalChat))
+		return;
+	player.setChatBubble(StringView(message.data(), message.size()),
+		Colour::White(), LOCAL_CHAT_RADIUS,
+		Milliseconds(CHAT_BUBBLE_EXPIRATION));
+
+	Utils::MessageBuilder builder;
+	builder.append("{C8C8C8}[local] ");
+	appendLine(builder, player, message);
+	auto line = StringView(builder.view().data(), builder.view().size());
+	player.sendClientMessage(Colour::White(), line);
+
+	const auto center = player.getPosition();
+	const auto world = player.getVirtualWorld();
+	this->positions.insert(player.getID(), center);
+	this->positions.forEachInRadius(center,
+		LOCAL_CHAT_RADIUS + LOCAL_CHAT_INDEX_MARGIN,
+		[&](int id, float)
+		{
+			if (id == player.getID())
+				return;
+			auto recipient = this->playerPool->get(id);
+			if (!recipient || recipient->getVirtualWorld() != world)
+				return;
+			// the index may be a second old, check where they are now
+			auto position = recipient->getPosition();
+			float dx = position.x - center.x;
+			float dy = position.y - center.y;
+			float dz = position.z - center.z;
+			if (dx * dx + dy * dy + dz * dz
+				<= LOCAL_CHAT_RADIUS * LOCAL_CHAT_RADIUS)
+				recipient->sendClientMessage(Colour::White(), line);
+		});
+}
+
+void ChatService::onPlayerConnect(IPlayer& player)
+{
+	this->positions.insert(player.getID(), player.getPosition());
+}
+
+void ChatService::onPlayerDisconnect(
+	IPlayer& player, PeerDisconnectReason reason)
+{
+	this->positions.remove(player.getID());
+}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ModeManager.hpp"
+#include "RateLimiter.hpp"
+#include "commands/CommandManager.hpp"
+#include "utils/MessageBuilder.hpp"
+#include "utils/SpatialGrid.hpp"
+
+#include <Server/Components/Timers/timers.hpp>
+#include <player.hpp>
+
+#include <memory>
+#include <string_view>
+
+namespace Core
+{
+inline const auto CHAT_BUBBLE_EXPIRATION = 10000;
+
+inline const float LOCAL_CHAT_RADIUS = 30.0;
+inline const auto LOCAL_CHAT_INDEX_INTERVAL = Milliseconds(1000);
+/// how far a player may have moved since the last index refresh, local chat
+/// looks this much further and then checks the real distance
+inline const float LOCAL_CHAT_INDEX_MARGIN = 80.0;
+
+/// Delivers chat messages to the players of a channel: everyone on the
+/// server, the sender's mode, the sender's room or the players around them.
+/// Only the recipients of a channel are visited, local chat finds them in a
+/// position index that is refreshed on a timer. Every channel has its own
+/// flood budget.
+class ChatService : public PlayerConnectEventHandler
+{
+	IPlayerPool* playerPool;
+	ITimer* indexTimer = nullptr;
+	std::shared_ptr<ModeManager> modeManager;
+	std::shared_ptr<Commands::CommandManager> commandManager;
+	std::shared_ptr<RateLimiter> rateLimiter;
+	Utils::SpatialGrid<int> positions;
+
+	void initCommands();
+	void refreshPositions();
+	/// The sender's name in their colour, followed by the message
+	static void appendLine(Utils::MessageBuilder& builder, IPlayer& player,
+		std::string_view message);
+	/// nullptr if the player isn't in a mode
+	Modes::ModeBase* getMode(IPlayer& player);
+
+public:
+	ChatService(IPlayerPool* playerPool, ITimersComponent* timersComponent,
+		std::shared_ptr<ModeManager> modeManager,
+		std::shared_ptr<Commands::CommandManager> commandManager,
+		std::shared_ptr<RateLimiter> rateLimiter);
+	~ChatService();
+
+	void sendGlobal(IPlayer& player, std::string_view message);
+	void sendMode(IPlayer& player, std::string_view message);
+	void sendRoom(IPlayer& player, std::string_view message);
+	void sendLocal(IPlayer& player, std::string_view message);
+
+	void onPlayerConnect(IPlayer& player) override;
+	void onPlayerDisconnect(
+		IPlayer& player, PeerDisconnectReason reason) override;
+};
+}
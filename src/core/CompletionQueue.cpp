@@ -0,0 +1,78 @@
+#include "CompletionQueue.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <exception>
+#include <thread>
+#include <utility>
+
+namespace Core
+{
+CompletionQueue::CompletionQueue(std::size_t capacity)
+	: queue(capacity)
+{
+}
+
+bool CompletionQueue::post(Completion completion)
+{
+	if (this->closed.load(std::memory_order_acquire))
+	{
+		this->dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	if (!this->queue.tryPush(std::move(completion)))
+	{
+		this->overflows.fetch_add(1, std::memory_order_relaxed);
+		while (!this->queue.tryPush(std::move(completion)))
+		{
+			// nobody is going to make room any more
+			if (this->closed.load(std::memory_order_acquire))
+			{
+				this->dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			std::this_thread::yield();
+		}
+	}
+	this->posted.fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+std::size_t CompletionQueue::drain()
+{
+	// never more than a full queue at once, so producers that keep posting
+	// can't hold up the tick
+	std::size_t count = 0;
+	Completion completion;
+	while (count < this->queue.capacity() && this->queue.tryPop(completion))
+	{
+		count++;
+		try
+		{
+			completion();
+		}
+		catch (const std::exception& e)
+		{
+			spdlog::error("Completion failed: {}", e.what());
+		}
+		completion = nullptr;
+	}
+	this->drained.fetch_add(count, std::memory_order_relaxed);
+	return count;
+}
+
+void CompletionQueue::close()
+{
+	this->closed.store(true, std::memory_order_release);
+}
+
+CompletionQueueStats CompletionQueue::stats() const
+{
+	return CompletionQueueStats {
+		.posted = this->posted.load(std::memory_order_relaxed),
+		.drained = this->drained.load(std::memory_order_relaxed),
+		.overflows = this->overflows.load(std::memory_order_relaxed),
+		.dropped = this->dropped.load(std::memory_order_relaxed),
+	};
+}
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "utils/InplaceFunction.hpp"
+#include "utils/MpscQueue.hpp"
+
+#include <types.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Core
+{
+inline const std::size_t COMPLETION_QUEUE_CAPACITY = 4096;
+inline const auto COMPLETION_DRAIN_INTERVAL = Milliseconds(5);
+
+struct CompletionQueueStats
+{
+	std::uint64_t posted = 0;
+	std::uint64_t drained = 0;
+	/// times a producer found the queue full and had to wait for a drain
+	std::uint64_t overflows = 0;
+	/// completions posted after the queue was closed
+	std::uint64_t dropped = 0;
+};
+
+/// The way back to the main thread for work done elsewhere: database
+/// writes, password hashing and the like post a completion here, and the
+/// main thread runs it on its next drain, where touching players, dialogs
+/// and the rest of the game state is safe again.
+class CompletionQueue
+{
+public:
+	typedef Utils::InplaceFunction<void()> Completion;
+
+	explicit CompletionQueue(std::size_t capacity = COMPLETION_QUEUE_CAPACITY);
+
+	/// Any thread. Until the queue is closed completions are never dropped,
+	/// if the queue is full the caller waits until the main thread makes
+	/// room. Posting from the main thread itself is only safe while the
+	/// queue is far from full. Returns false if the completion was dropped
+	/// because the queue is closed.
+	bool post(Completion completion);
+
+	/// Main thread only. Runs the completions posted so far and returns how
+	/// many there were
+	std::size_t drain();
+
+	/// Called when the main thread stops draining. Completions posted from
+	/// then on are dropped, and producers waiting for room give up, so
+	/// workers that are being joined can't hang on a full queue.
+	void close();
+
+	CompletionQueueStats stats() const;
+
+private:
+	Utils::MpscQueue<Completion> queue;
+	std::atomic<std::uint64_t> posted = 0;
+	std::atomic<std::uint64_t> drained = 0;
+	std::atomic<std::uint64_t> overflows = 0;
+	std::atomic<std::uint64_t> dropped = 0;
+	std::atomic<bool> closed = false;
+};
+}
@@ -1,11 +1,11 @@
 #include "CoreManager.hpp"
+#include "DeferredQueue.hpp"
 #include "ModeManager.hpp"
 #include "SQLQueryManager.hpp"
 #include "Server/Components/Vehicles/vehicles.hpp"
 #include "commands/CommandManager.hpp"
 #include "controllers/PlayerOnFireController.hpp"
 #include "controllers/SpeedometerController.hpp"
-#include "eventbus/event_bus.hpp"
 #include "player.hpp"
 #include "player/PlayerExtension.hpp"
 #include "textdraws/ITextDrawWrapper.hpp"
@@ -16,8 +16,12 @@
 #include "utils/Common.hpp"
 #include "utils/ConnectionPool.hpp"
 #include "utils/IDPool.hpp"
+#include "utils/Logging.hpp"
 #include "utils/QueryNames.hpp"
+#include "utils/Random.hpp"
 #include "utils/ServiceLocator.hpp"
+#include "utils/TickArena.hpp"
+#include "utils/AllocationTracker.hpp"
 #include "../modes/freeroam/FreeroamController.hpp"
 #include "../modes/deathmatch/DeathmatchController.hpp"
 #include "../modes/x1/X1Controller.hpp"
@@ -32,10 +36,11 @@
 #include <spdlog/spdlog.h>
 #include <fmt/printf.h>
 #include <Server/Components/Timers/timers.hpp>
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
 #include <stdexcept>
 #include <string>
-#include <thread>
-#include <random>
+#include <string_view>
+#include <vector>
 
 namespace Core
 {
@@ -44,17 +49,48 @@ CoreManager::CoreManager(IComponentList* components, ICore* core,
 	: components(components)
 	, _core(core)
 	, playerPool(playerPool)
-	, _dialogManager(
-		  std::shared_ptr<DialogManager>(new DialogManager(components)))
-	, _commandManager(std::shared_ptr<Commands::CommandManager>(
-		  new Commands::CommandManager(playerPool)))
 	, _classesComponent(components->queryComponent<IClassesComponent>())
+	, slotTracker(std::make_unique<Player::PlayerSlotTracker>(playerPool))
+	, rateLimiter(std::make_shared<RateLimiter>(playerPool))
+	, _dialogManager(std::shared_ptr<DialogManager>(
+		  new DialogManager(components, this->rateLimiter)))
+	, _commandManager(std::shared_ptr<Commands::CommandManager>(
+		  new Commands::CommandManager(playerPool, this->rateLimiter)))
 	, _playerControllers(std::make_unique<ServiceLocator>())
-	, bus(std::make_shared<dp::event_bus>())
-	, connectionPool(connection_string, 8)
+	, bus(std::make_shared<Utils::EventBus>())
+	, completions(std::make_shared<CompletionQueue>())
+	, connectionPool(connection_string, DB_CONNECTIONS_COUNT, false)
+	, startupScheduler(std::make_shared<StartupScheduler>(
+		  components->queryComponent<ITimersComponent>()))
+	, serverStats(std::make_unique<ServerStats>(core, playerPool,
+		  components->queryComponent<ITimersComponent>(), connectionPool,
+		  *completions))
+	, killsMetric(Utils::metrics().counter(
+		  "oasis_kills_total", "Players killed by another player"))
+	, saveDurationMetric(Utils::metrics().histogram(
+		  "oasis_player_save_seconds", "Time it takes to save a player",
+		  Utils::LATENCY_BUCKETS))
+	, tickHandlerMetric(Utils::metrics().histogram("oasis_tick_handler_seconds",
+		  "Time spent in the gamemode's end of tick work",
+		  Utils::LATENCY_BUCKETS))
 	, virtualWorldIdPool(std::make_shared<Utils::IDPool>())
+	, cbugDetector(std::make_shared<Modes::CbugDetector>(
+		  components->queryComponent<ITimersComponent>()))
 {
+	cp::validate_connection_string(connection_string);
+	for (const auto& [name, query] : SQLQueryManager::Get()->getQueries())
+		this->connectionPool.prepare_on_connect(name, query);
+	this->startupScheduler->runAsync("database connections",
+		[this]()
+		{
+			this->connectionPool.connect(DB_MIN_READY_CONNECTIONS);
+		});
 	this->initSkinSelection();
+	this->initMetrics();
+	auto deferSideEffects = std::getenv("DEFER_SIDE_EFFECTS");
+	if (deferSideEffects != nullptr
+		&& std::string_view(deferSideEffects) == "0")
+		DeferredQueue::Get()->runSynchronously(*this->playerPool);
 
 	playerPool->getPlayerConnectDispatcher().addEventHandler(this);
 	playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
@@ -62,12 +98,29 @@ CoreManager::CoreManager(IComponentList* components, ICore* core,
 	playerPool->getPlayerDamageDispatcher().addEventHandler(this);
 
 	_classesComponent->getEventDispatcher().addEventHandler(this);
-
-	this->saveThread = std::thread(&CoreManager::runSaveThread, this,
-		std::move(this->saveThreadExitSignal.get_future()));
-	this->saveThread.detach();
-
-	this->modeManager = std::make_shared<ModeManager>(this->_dialogManager);
+	_core->getEventDispatcher().addEventHandler(this);
+
+	auto timersComponent = components->queryComponent<ITimersComponent>();
+	this->completionTimer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->completions->drain();
+			}),
+		COMPLETION_DRAIN_INTERVAL, true);
+	this->autosaveTimer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->saveAllPlayersAsync();
+			}),
+		AUTOSAVE_INTERVAL, true);
+
+	this->modeManager = std::make_shared<ModeManager>(
+		this->_dialogManager, playerPool, timersComponent);
+	this->chatService = std::make_unique<ChatService>(playerPool,
+		timersComponent, this->modeManager, this->_commandManager,
+		this->rateLimiter);
 }
 
 std::unique_ptr<CoreManager> CoreManager::create(IComponentList* components,
@@ -76,13 +129,27 @@ std::unique_ptr<CoreManager> CoreManager::create(IComponentList* components,
 {
 	std::unique_ptr<CoreManager> pManager(
 		new CoreManager(components, core, playerPool, db_connection_string));
+	// a connection string that parses can still point nowhere, don't
+	// create the world if connecting has already failed
+	pManager->startupScheduler->check("database connections");
 	pManager->initHandlers();
+	// the rest of the world keeps coming up over the next ticks, but the
+	// database has to be reachable before we accept any player
+	pManager->startupScheduler->wait("database connections");
+	pManager->startupScheduler->seal();
 	return pManager;
 }
 
 CoreManager::~CoreManager()
 {
-	this->saveThreadExitSignal.set_value();
+	this->autosaveTimer->kill();
+	this->completionTimer->kill();
+	// nothing drains the queue from here on, the autosave and the password
+	// workers must not wait for room in it while they're being joined
+	this->completions->close();
+	if (this->autosave.valid())
+		this->autosave.wait();
+	this->completions->drain();
 	saveAllPlayers();
 	playerPool->getPlayerConnectDispatcher().removeEventHandler(this);
 	playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
@@ -90,6 +157,7 @@ CoreManager::~CoreManager()
 	playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
 
 	_classesComponent->getEventDispatcher().removeEventHandler(this);
+	_core->getEventDispatcher().removeEventHandler(this);
 }
 
 void CoreManager::onPlayerConnect(IPlayer& player)
@@ -101,7 +169,8 @@ void CoreManager::onPlayerConnect(IPlayer& player)
 	player.addExtension(playerExt, true);
 
 	player.setColour(Colour::FromRGBA(
-		Utils::NICKNAME_COLORS[rand() % Utils::NICKNAME_COLORS.size()]));
+		Utils::NICKNAME_COLORS[Utils::randomIndex(
+			Utils::NICKNAME_COLORS.size())]));
 
 	auto txdManager = playerExt->getTextDrawManager();
 	auto logo
@@ -128,27 +197,51 @@ void CoreManager::onPlayerDisconnect(
 
 void CoreManager::initHandlers()
 {
-	_authController = std::make_unique<Auth::AuthController>(this->components,
-		this->playerPool, this->connectionPool, this->modeManager,
-		this->_dialogManager);
-
-	modeManager->addMode(
-		std::make_unique<Modes::Freeroam::FreeroamController>(this->components,
-			this->playerPool, this->virtualWorldIdPool, this->modeManager,
-			this->_dialogManager, this->_commandManager, this->bus));
-	modeManager->addMode(
-		std::make_unique<Modes::Deathmatch::DeathmatchController>(
-			this->modeManager, this->_commandManager, _dialogManager,
-			playerPool, components->queryComponent<ITimersComponent>(),
-			this->bus, connectionPool, this->virtualWorldIdPool));
-	modeManager->addMode(std::make_unique<Modes::X1::X1Controller>(
-		this->modeManager, this->virtualWorldIdPool, _commandManager,
-		_dialogManager, playerPool,
-		components->queryComponent<ITimersComponent>(), this->bus));
-	modeManager->addMode(std::make_unique<Modes::Duel::DuelController>(
-		modeManager, _commandManager, _dialogManager, playerPool,
-		components->queryComponent<ITimersComponent>(), this->bus,
-		this->virtualWorldIdPool));
+	this->startupScheduler->run("auth",
+		[this]()
+		{
+			_authController = std::make_unique<Auth::AuthController>(
+				this->components, this->playerPool, this->connectionPool,
+				this->modeManager, this->_dialogManager, this->completions);
+		});
+
+	this->startupScheduler->run("freeroam mode",
+		[this]()
+		{
+			modeManager->addMode(
+				std::make_unique<Modes::Freeroam::FreeroamController>(
+					this->components, this->playerPool,
+					this->virtualWorldIdPool, this->modeManager,
+					this->_dialogManager, this->_commandManager, this->bus,
+					this->startupScheduler, this->rateLimiter));
+		});
+	this->startupScheduler->run("deathmatch mode",
+		[this]()
+		{
+			modeManager->addMode(
+				std::make_unique<Modes::Deathmatch::DeathmatchController>(
+					this->modeManager, this->_commandManager, _dialogManager,
+					playerPool, components->queryComponent<ITimersComponent>(),
+					this->bus, connectionPool, this->virtualWorldIdPool,
+					this->cbugDetector));
+		});
+	this->startupScheduler->run("x1 mode",
+		[this]()
+		{
+			modeManager->addMode(std::make_unique<Modes::X1::X1Controller>(
+				this->modeManager, this->virtualWorldIdPool, _commandManager,
+				_dialogManager, playerPool,
+				components->queryComponent<ITimersComponent>(), this->bus,
+				this->cbugDetector));
+		});
+	this->startupScheduler->run("duel mode",
+		[this]()
+		{
+			modeManager->addMode(std::make_unique<Modes::Duel::DuelController>(
+				modeManager, _commandManager, _dialogManager, playerPool,
+				components->queryComponent<ITimersComponent>(), this->bus,
+				this->virtualWorldIdPool, this->cbugDetector));
+		});
 
 	_playerControllers->registerInstance(new Controllers::SpeedometerController(
 		playerPool, components->queryComponent<IVehiclesComponent>(),
@@ -171,26 +264,34 @@ void CoreManager::savePlayer(std::shared_ptr<PlayerModel> data)
 {
 	if (!data->tempData->core->isLoggedIn)
 		return;
+	this->writePlayer(data);
+}
 
+void CoreManager::writePlayer(std::shared_ptr<PlayerModel> data)
+{
+	auto startedAt = std::chrono::steady_clock::now();
 	auto basic_tx = cp::tx(this->connectionPool);
-	auto& txn = basic_tx.get();
+	{
+		// everything below goes out in a single round-trip
+		cp::pipeline_batch batch(basic_tx);
 
-	// save general player info
-	txn.exec_params(SQLQueryManager::Get()
-						->getQueryByName(Utils::SQL::Queries::SAVE_PLAYER)
-						.value(),
-		data->language, data->lastSkinId, data->lastIP, data->lastLoginAt, data->userId);
+		// save general player info
+		batch.exec_prepared(Utils::SQL::Queries::SAVE_PLAYER, data->language,
+			data->lastSkinId, data->lastIP, data->lastLoginAt, data->userId);
 
-	// save player settings
-	txn.exec_params(SQLQueryManager::Get()
-						->getQueryByName(Utils::SQL::Queries::SAVE_PLAYER_SETTINGS)
-						.value(),
-		data->settings->pmsEnabled, data->userId);
+		// save player settings
+		batch.exec_prepared(Utils::SQL::Queries::SAVE_PLAYER_SETTINGS,
+			data->settings->pmsEnabled, data->userId);
 
-	this->modeManager->savePlayer(data, txn);
+		this->modeManager->savePlayer(data, batch);
+		batch.flush();
+	}
 	basic_tx.commit();
+	this->saveDurationMetric.observe(
+		std::chrono::steady_clock::now() - startedAt);
 
-	spdlog::info("Player {} has been successfully saved", data->name);
+	OASIS_LOG_LIMITED(spdlog::level::info, Utils::LOG_PLAYER_EVENTS_LIMIT,
+		"Player {} has been successfully saved", data->name);
 }
 
 void CoreManager::savePlayer(IPlayer& player)
@@ -198,17 +299,82 @@ void CoreManager::savePlayer(IPlayer& player)
 	this->savePlayer(this->playerData[player.getID()]);
 }
 
+void CoreManager::initMetrics()
+{
+	auto& metrics = Utils::metrics();
+	auto pool = &this->connectionPool;
+	metrics.callback("oasis_db_connections_in_use",
+		"Database connections borrowed right now", Utils::MetricType::Gauge,
+		[pool]()
+		{
+			return double(pool->in_use_count());
+		});
+	metrics.callback("oasis_db_connections_ready",
+		"Database connections opened and warmed up", Utils::MetricType::Gauge,
+		[pool]()
+		{
+			return double(pool->ready_connections());
+		});
+	metrics.callback("oasis_db_borrows_total",
+		"Database connections borrowed from the pool",
+		Utils::MetricType::Counter,
+		[pool]()
+		{
+			return double(pool->borrow_count());
+		});
+	metrics.callback("oasis_db_borrow_wait_seconds_total",
+		"Time spent waiting for a free database connection",
+		Utils::MetricType::Counter,
+		[pool]()
+		{
+			return std::chrono::duration<double>(pool->borrow_wait()).count();
+		});
+	metrics.callback("oasis_db_statements_total",
+		"Statements sent to the database", Utils::MetricType::Counter,
+		[pool]()
+		{
+			return double(pool->statement_count());
+		});
+	metrics.callback("oasis_db_round_trips_total",
+		"Round-trips made to the database", Utils::MetricType::Counter,
+		[pool]()
+		{
+			return double(pool->round_trip_count());
+		});
+
+	auto completions = this->completions;
+	metrics.callback("oasis_completions_pending",
+		"Completions waiting for the main thread", Utils::MetricType::Gauge,
+		[completions]()
+		{
+			auto stats = completions->stats();
+			return double(stats.posted - stats.drained);
+		});
+	metrics.callback("oasis_completion_overflows_total",
+		"Times a thread had to wait for room in the completion queue",
+		Utils::MetricType::Counter,
+		[completions]()
+		{
+			return double(completions->stats().overflows);
+		});
+
+	auto metricsFile = std::getenv("METRICS_FILE");
+	if (metricsFile != nullptr && *metricsFile != '\0')
+		this->metricsExporter = std::make_unique<MetricsExporter>(metricsFile);
+}
+
 void CoreManager::initSkinSelection()
 {
 	IClassesComponent* classesComponent
 		= this->components->queryComponent<IClassesComponent>();
-	for (int i = 0; i <= 311; i++)
-	{
-		if (i == 74) // skip invalid skin
-			continue;
-		classesComponent->create(i, TEAM_NONE, Vector3(0, 0, 0), 0.0,
-			WeaponSlots { WeaponSlotData { 0, 0 } });
-	}
+	this->startupScheduler->runSliced("skin classes", 312, 64,
+		[classesComponent](std::size_t skinId)
+		{
+			if (skinId == 74) // skip invalid skin
+				return;
+			classesComponent->create(skinId, TEAM_NONE, Vector3(0, 0, 0), 0.0,
+				WeaponSlots { WeaponSlotData { 0, 0 } });
+		});
 }
 
 bool CoreManager::onPlayerRequestClass(IPlayer& player, unsigned int classId)
@@ -222,7 +388,8 @@ bool CoreManager::onPlayerRequestClass(IPlayer& player, unsigned int classId)
 		playerData->tempData->core->skinSelectionMode = true;
 
 		Vector4 classSelectionPoint
-			= CLASS_SELECTION_POINTS[rand() % CLASS_SELECTION_POINTS.size()];
+			= CLASS_SELECTION_POINTS[Utils::randomIndex(
+				CLASS_SELECTION_POINTS.size())];
 		player.setPosition(Vector3(classSelectionPoint));
 
 		auto playerExt = Player::getPlayerExt(player);
@@ -267,65 +434,118 @@ void CoreManager::onPlayerSpawn(IPlayer& player)
 	playerData->tempData->core->isDying = false;
 }
 
-void CoreManager::runSaveThread(std::future<void> exitSignal)
+void CoreManager::saveAllPlayersAsync()
 {
-	while (exitSignal.wait_for(std::chrono::minutes(3))
-		== std::future_status::timeout)
+	if (this->autosave.valid()
+		&& this->autosave.wait_for(std::chrono::seconds(0))
+			!= std::future_status::ready)
+	{
+		spdlog::warn("Previous autosave is still running, skipping this one");
+		return;
+	}
+
+	// the models keep changing on the main thread while the worker saves,
+	// so it only gets copies taken here
+	std::vector<std::shared_ptr<PlayerModel>> players;
+	players.reserve(this->playerData.size());
+	for (const auto& [id, data] : this->playerData)
 	{
-		spdlog::info("Saving player data...");
-		this->saveAllPlayers();
+		if (data->tempData->core->isLoggedIn)
+			players.push_back(data->snapshot());
 	}
+
+	spdlog::info("Saving player data...");
+	this->autosave = std::async(std::launch::async,
+		[this, players = std::move(players)]()
+		{
+			auto startedAt = std::chrono::steady_clock::now();
+			std::size_t failed = 0;
+			for (const auto& data : players)
+			{
+				try
+				{
+					this->writePlayer(data);
+				}
+				catch (const std::exception& e)
+				{
+					failed++;
+					spdlog::error("Failed to save player {}: {}", data->name,
+						e.what());
+				}
+			}
+			auto elapsed = std::chrono::steady_clock::now() - startedAt;
+			this->completions->post(
+				[saved = players.size() - failed, failed, elapsed]()
+				{
+					spdlog::info("Saved {} players in {} ms, {} failed", saved,
+						std::chrono::duration_cast<std::chrono::milliseconds>(
+							elapsed)
+							.count(),
+						failed);
+				});
+		});
 }
 
 bool CoreManager::onPlayerText(IPlayer& player, StringView message)
 {
+	OASIS_ALLOCATION_SCOPE("onPlayerText");
 	auto playerExt = Player::getPlayerExt(player);
 	if (!playerExt->isAuthorized())
 		return false;
-	player.setChatBubble(
-		message, Colour::White(), 100.0, Milliseconds(CHAT_BUBBLE_EXPIRATION));
-
-	for (auto sPlayer : playerPool->players())
-	{
-		if (!playerExt->isInAnyMode())
-			sPlayer->sendClientMessage(Colour::White(),
-				fmt::sprintf("{%06x}%s(%d){FFFFFF}: %s",
-					player.getColour().RGBA() >> 8,
-					player.getName().to_string(), player.getID(),
-					message.to_string()));
-		else
-			sPlayer->sendClientMessage(Colour::White(),
-				fmt::sprintf("{%s}%s: {%06x}%s(%d){FFFFFF}: %s",
-					Modes::getModeColor(playerExt->getMode()),
-					Modes::getModeShortName(playerExt->getMode()),
-					player.getColour().RGBA() >> 8,
-					player.getName().to_string(), player.getID(),
-					message.to_string()));
-	}
-
+	this->chatService->sendGlobal(
+		player, std::string_view(message.data(), message.size()));
 	return false;
 }
 
-void CoreManager::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
+void CoreManager::onTick(Microseconds elapsed, TimePoint now)
 {
-	playerPool->sendDeathMessageToAll(killer, player, reason);
+	auto startedAt = std::chrono::steady_clock::now();
+	DeferredQueue::Get()->flush(*this->playerPool);
+	Utils::tickArena().reset();
+	this->tickHandlerMetric.observe(
+		std::chrono::steady_clock::now() - startedAt);
+}
 
+void CoreManager::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
+{
 	auto playerData = Player::getPlayerData(player);
 	playerData->tempData->core->isDying = true;
+	if (killer)
+		this->killsMetric.increment();
+
+	// kill feed and notifications go out with the rest of the tick's work
+	auto deferred = DeferredQueue::Get();
+	deferred->post(
+		[playerId = player.getID(), killerId = killer ? killer->getID() : -1,
+			reason](IPlayerPool& playerPool)
+		{
+			auto player = playerPool.get(playerId);
+			if (!player)
+				return;
+			auto killer = killerId < 0 ? nullptr : playerPool.get(killerId);
+			playerPool.sendDeathMessageToAll(killer, *player, reason);
+		});
 
 	if (killer)
 	{
-		auto killerExt = Player::getPlayerExt(*killer);
-		auto playerExt = Player::getPlayerExt(player);
-		playerExt->showNotification(
-			fmt::sprintf(_("~w~You got killed by~n~~r~%s(%d)", player),
-				killer->getName().to_string(), killer->getID()),
-			TextDraws::NotificationPosition::Bottom, 4);
-
-		killerExt->showNotification(
-			fmt::sprintf(_("~w~You killed~n~~r~%s(%d)", player),
-				player.getName().to_string(), player.getID()),
-			TextDraws::NotificationPosition::Bottom, 6);
+		auto killedBy
+			= fmt::sprintf(_("~w~You got killed by~n~~r~%s(%d)", player),
+				killer->getName().to_string(), killer->getID());
+		deferred->post(player, DeferredKey::BottomNotification,
+			[killedBy = std::move(killedBy)](IPlayer& player)
+			{
+				Player::getPlayerExt(player)->showNotification(
+					killedBy, TextDraws::NotificationPosition::Bottom, 4);
+			});
+
+		auto killed = fmt::sprintf(_("~w~You killed~n~~r~%s(%d)", *killer),
+			player.getName().to_string(), player.getID());
+		deferred->post(*killer, DeferredKey::BottomNotification,
+			[killed = std::move(killed)](IPlayer& killer)
+			{
+				Player::getPlayerExt(killer)->showNotification(
+					killed, TextDraws::NotificationPosition::Bottom, 6);
+			});
 	}
 }
 }
\ No newline at end of file
@@ -1,23 +1,34 @@
 #pragma once
 
+#include "ChatService.hpp"
+#include "CompletionQueue.hpp"
+#include "MetricsExporter.hpp"
 #include "ModeManager.hpp"
+#include "RateLimiter.hpp"
+#include "ServerStats.hpp"
+#include "StartupScheduler.hpp"
 #include "dialogs/DialogManager.hpp"
 #include "auth/AuthController.hpp"
 #include "commands/CommandManager.hpp"
+#include "player/PlayerHandle.hpp"
 #include "player/PlayerModel.hpp"
 #include "utils/ConnectionPool.hpp"
+#include "utils/EventBus.hpp"
 #include "utils/IDPool.hpp"
+#include "utils/Metrics.hpp"
 #include "utils/ServiceLocator.hpp"
+#include "../modes/CbugDetector.hpp"
 
 #include <Server/Components/Classes/classes.hpp>
+#include <Server/Components/Timers/timers.hpp>
+#include <core.hpp>
 #include <future>
 #include <map>
 #include <player.hpp>
-#include <eventbus/event_bus.hpp>
 
+#include <chrono>
 #include <memory>
 #include <string>
-#include <thread>
 #include <unordered_map>
 
 namespace Core
@@ -30,9 +41,14 @@ inline const auto CLASS_SELECTION_POINTS = std::to_array({
 
 inline const auto GENERAL_COMMAND_CATEGORY = "general"s;
 
-inline const auto CHAT_BUBBLE_EXPIRATION = 10000;
+inline const auto AUTOSAVE_INTERVAL = std::chrono::minutes(3);
 
-class CoreManager : public PlayerConnectEventHandler,
+inline const unsigned int DB_CONNECTIONS_COUNT = 8;
+// connections that must be up before the gamemode starts serving players
+inline const unsigned int DB_MIN_READY_CONNECTIONS = 2;
+
+class CoreManager : public CoreEventHandler,
+					public PlayerConnectEventHandler,
 					public ClassEventHandler,
 					public PlayerSpawnEventHandler,
 					public PlayerTextEventHandler,
@@ -54,6 +70,7 @@ public:
 	void onPlayerSpawn(IPlayer& player) override;
 	bool onPlayerText(IPlayer& player, StringView message) override;
 	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
+	void onTick(Microseconds elapsed, TimePoint now) override;
 
 private:
 	CoreManager(IComponentList* components, ICore* core,
@@ -61,24 +78,42 @@ private:
 
 	void initHandlers();
 	void initSkinSelection();
+	void initMetrics();
 	void savePlayer(std::shared_ptr<PlayerModel> data);
 	void savePlayer(IPlayer& player);
+	/// Saves the data whether or not the player is logged in
+	void writePlayer(std::shared_ptr<PlayerModel> data);
 	void saveAllPlayers();
-	void runSaveThread(std::future<void> exitSignal);
+	void saveAllPlayersAsync();
 
 	IPlayerPool* const playerPool = nullptr;
 	ICore* const _core = nullptr;
 	IClassesComponent* const _classesComponent;
+	std::unique_ptr<Player::PlayerSlotTracker> slotTracker;
+	// the managers below check it, so it has to come before them
+	std::shared_ptr<RateLimiter> rateLimiter;
 
-	std::shared_ptr<dp::event_bus> bus;
+	std::shared_ptr<Core::Utils::EventBus> bus;
+	std::shared_ptr<CompletionQueue> completions;
+	ITimer* completionTimer = nullptr;
+	ITimer* autosaveTimer = nullptr;
+	std::future<void> autosave;
 
 	std::shared_ptr<Commands::CommandManager> _commandManager;
 	std::shared_ptr<DialogManager> _dialogManager;
 	cp::connection_pool connectionPool;
-	std::thread saveThread;
-	std::promise<void> saveThreadExitSignal;
+	std::shared_ptr<StartupScheduler> startupScheduler;
+	std::unique_ptr<ServerStats> serverStats;
+	// reads the connection pool and the completion queue, so it has to go
+	// before them
+	std::unique_ptr<MetricsExporter> metricsExporter;
+	Utils::Counter& killsMetric;
+	Utils::Histogram& saveDurationMetric;
+	Utils::Histogram& tickHandlerMetric;
 	std::shared_ptr<Utils::IDPool> virtualWorldIdPool;
+	std::shared_ptr<Modes::CbugDetector> cbugDetector;
 	std::shared_ptr<ModeManager> modeManager;
+	std::unique_ptr<ChatService> chatService;
 	std::map<unsigned int, std::shared_ptr<PlayerModel>> playerData;
 
 	// Controllers
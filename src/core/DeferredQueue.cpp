@@ -0,0 +1,117 @@
+#include "DeferredQueue.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <exception>
+#include <utility>
+
+namespace Core
+{
+int& DeferredQueue::coalescedIndex(DeferredKey key, int slot)
+{
+	if (!this->initialized)
+	{
+		for (auto& slots : this->coalesced)
+			slots.fill(-1);
+		this->initialized = true;
+	}
+	return this->coalesced[static_cast<std::size_t>(key)][slot];
+}
+
+void DeferredQueue::runSynchronously(IPlayerPool& playerPool)
+{
+	this->flush(playerPool);
+	this->playerPool = &playerPool;
+	spdlog::info("Deferred side effects run synchronously");
+}
+
+void DeferredQueue::run(Entry& entry, IPlayerPool& playerPool)
+{
+	try
+	{
+		if (entry.player.slot < 0)
+		{
+			entry.task(playerPool);
+			return;
+		}
+		if (auto player = entry.player.get())
+			entry.playerTask(*player);
+	}
+	catch (const std::exception& e)
+	{
+		spdlog::error("Deferred task failed: {}", e.what());
+	}
+}
+
+void DeferredQueue::post(Task task)
+{
+	Entry entry { .task = std::move(task) };
+	if (this->playerPool)
+	{
+		this->run(entry, *this->playerPool);
+		return;
+	}
+	this->entries.push_back(std::move(entry));
+}
+
+void DeferredQueue::post(IPlayer& player, PlayerTask task)
+{
+	Entry entry {
+		.player = Player::PlayerHandle::of(player),
+		.playerTask = std::move(task),
+	};
+	if (this->playerPool)
+	{
+		this->run(entry, *this->playerPool);
+		return;
+	}
+	this->entries.push_back(std::move(entry));
+}
+
+void DeferredQueue::post(IPlayer& player, DeferredKey key, PlayerTask task)
+{
+	auto handle = Player::PlayerHandle::of(player);
+	if (this->playerPool)
+	{
+		Entry entry { .player = handle, .playerTask = std::move(task) };
+		this->run(entry, *this->playerPool);
+		return;
+	}
+
+	auto& index = this->coalescedIndex(key, handle.slot);
+	if (index >= 0)
+	{
+		// the slot may have changed hands since, the newer player's task
+		// replaces the one for whoever left
+		auto& entry = this->entries[index];
+		entry.player = handle;
+		entry.playerTask = std::move(task);
+		return;
+	}
+
+	index = this->entries.size();
+	this->entries.push_back(Entry {
+		.player = handle,
+		.key = key,
+		.playerTask = std::move(task),
+	});
+}
+
+void DeferredQueue::flush(IPlayerPool& playerPool)
+{
+	if (this->entries.empty())
+		return;
+
+	// swap the buffers, both keep their capacity from tick to tick
+	std::swap(this->entries, this->flushing);
+	for (const auto& entry : this->flushing)
+	{
+		if (entry.key != DeferredKey::Count)
+			this->coalescedIndex(entry.key, entry.player.slot) = -1;
+	}
+
+	for (auto& entry : this->flushing)
+		this->run(entry, playerPool);
+	this->flushing.clear();
+}
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "player/PlayerHandle.hpp"
+#include "utils/InplaceFunction.hpp"
+#include "utils/Singleton.hpp"
+
+#include <player.hpp>
+#include <values.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Core
+{
+/// Kinds of per-player side effects where only the latest one of a tick
+/// matters
+enum class DeferredKey
+{
+	TopNotification,
+	BottomNotification,
+	WantedLevel,
+	Count
+};
+
+/// Side effects of game events (notifications, kill feed, cross-mode events)
+/// that don't have to happen inside the handler that caused them. They are
+/// queued and run once at the end of the server tick, so the handlers of a
+/// single kill don't cascade into each other and repeated sends to a player
+/// within a tick collapse into one. Players are kept by handle and looked
+/// up again at flush time, work for a player that left in the meantime is
+/// dropped, even if somebody else has taken the slot since. Main thread
+/// only.
+///
+/// Setting DEFER_SIDE_EFFECTS=0 in the environment makes every task run
+/// as soon as it is posted, to tell whether deferring is behind a bug.
+class DeferredQueue : public Singleton<DeferredQueue>
+{
+public:
+	typedef Utils::InplaceFunction<void(IPlayerPool&)> Task;
+	typedef Utils::InplaceFunction<void(IPlayer&)> PlayerTask;
+
+	/// From now on tasks run inside post() instead of being queued
+	void runSynchronously(IPlayerPool& playerPool);
+	bool isSynchronous() const { return this->playerPool != nullptr; }
+
+	void post(Task task);
+	void post(IPlayer& player, PlayerTask task);
+	/// Replaces the task queued with the same key for the player this tick
+	void post(IPlayer& player, DeferredKey key, PlayerTask task);
+
+	/// Runs everything queued so far, work queued meanwhile waits for the
+	/// next flush
+	void flush(IPlayerPool& playerPool);
+
+private:
+	struct Entry
+	{
+		Player::PlayerHandle player;
+		DeferredKey key = DeferredKey::Count;
+		Task task;
+		PlayerTask playerTask;
+	};
+
+	std::vector<Entry> entries;
+	std::vector<Entry> flushing;
+	/// index into entries of the pending task per key and player slot
+	std::array<std::array<int, PLAYER_POOL_SIZE>,
+		static_cast<std::size_t>(DeferredKey::Count)>
+		coalesced;
+	bool initialized = false;
+	/// only set when tasks run synchronously
+	IPlayerPool* playerPool = nullptr;
+
+	int& coalescedIndex(DeferredKey key, int slot);
+	void run(Entry& entry, IPlayerPool& playerPool);
+};
+}
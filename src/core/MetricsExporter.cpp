@@ -0,0 +1,68 @@
+#include "MetricsExporter.hpp"
+#include "utils/Metrics.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+
+namespace Core
+{
+MetricsExporter::MetricsExporter(
+	std::filesystem::path path, std::chrono::milliseconds interval)
+	: path(std::move(path))
+	, interval(interval)
+{
+	this->thread = std::thread(&MetricsExporter::run, this);
+	spdlog::info("Exporting metrics to {}", this->path.string());
+}
+
+MetricsExporter::~MetricsExporter()
+{
+	{
+		std::lock_guard lock(this->mutex);
+		this->stopping = true;
+	}
+	this->wakeUp.notify_one();
+	this->thread.join();
+}
+
+void MetricsExporter::run()
+{
+	std::unique_lock lock(this->mutex);
+	while (true)
+	{
+		bool stopping = this->wakeUp.wait_for(lock, this->interval,
+			[this]()
+			{
+				return this->stopping;
+			});
+		lock.unlock();
+		this->write();
+		if (stopping)
+			return;
+		lock.lock();
+	}
+}
+
+void MetricsExporter::write()
+{
+	try
+	{
+		auto temporaryPath = this->path;
+		temporaryPath += ".tmp";
+		{
+			std::ofstream file(temporaryPath, std::ios::trunc);
+			file << Utils::metrics().render();
+			if (!file)
+				throw std::runtime_error("couldn't write the file");
+		}
+		std::filesystem::rename(temporaryPath, this->path);
+	}
+	catch (const std::exception& e)
+	{
+		spdlog::error("Failed to export metrics: {}", e.what());
+	}
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace Core
+{
+inline const auto METRICS_EXPORT_INTERVAL = std::chrono::seconds(15);
+
+/// Periodically writes the metrics registry to a file from a background
+/// thread, in the Prometheus text format, for node_exporter's textfile
+/// collector or anything else that can pick it up. The file is replaced
+/// atomically, so readers never see it half written.
+class MetricsExporter
+{
+	std::filesystem::path path;
+	std::chrono::milliseconds interval;
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	bool stopping = false;
+	std::thread thread;
+
+	void run();
+	void write();
+
+public:
+	MetricsExporter(std::filesystem::path path,
+		std::chrono::milliseconds interval = METRICS_EXPORT_INTERVAL);
+	/// Writes the metrics one last time and stops the thread
+	~MetricsExporter();
+};
+}
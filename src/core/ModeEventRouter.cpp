@@ -0,0 +1,101 @@
+#include "ModeEventRouter.hpp"
+#include "ModeManager.hpp"
+#include "player/PlayerExtension.hpp"
+
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
+
+namespace Core
+{
+ModeEventRouter::ModeEventRouter(ModeManager& modeManager,
+	IPlayerPool* playerPool, ITimersComponent* timersComponent)
+	: modeManager(modeManager)
+	, playerPool(playerPool)
+{
+	this->dirty.reserve(PLAYER_POOL_SIZE);
+	this->flushTimer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->flush();
+			}),
+		DAMAGE_FLUSH_INTERVAL, true);
+	playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
+	playerPool->getPlayerDamageDispatcher().addEventHandler(this);
+	playerPool->getPlayerChangeDispatcher().addEventHandler(this);
+}
+
+ModeEventRouter::~ModeEventRouter()
+{
+	this->flushTimer->kill();
+	playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
+	playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
+	playerPool->getPlayerChangeDispatcher().removeEventHandler(this);
+}
+
+void ModeEventRouter::flush(IPlayer& player, int slot)
+{
+	float amount = this->pending[slot];
+	if (amount == 0.0)
+		return;
+	this->pending[slot] = 0.0;
+	auto mode = Player::getPlayerExt(player)->getMode();
+	if (auto modeBase = this->modeManager.getMode(mode))
+		modeBase->onDamageFlush(player, amount);
+}
+
+void ModeEventRouter::flush()
+{
+	for (int slot : this->dirty)
+	{
+		if (auto player = this->playerPool->get(slot))
+			this->flush(*player, slot);
+		this->pending[slot] = 0.0;
+	}
+	this->dirty.clear();
+}
+
+void ModeEventRouter::flush(IPlayer& player)
+{
+	// the slot stays in the dirty list, the next full flush finds nothing
+	// pending for it and skips it
+	this->flush(player, player.getID());
+}
+
+void ModeEventRouter::onPlayerSpawn(IPlayer& player)
+{
+	auto mode = Player::getPlayerExt(player)->getMode();
+	if (auto modeBase = this->modeManager.getMode(mode))
+		modeBase->onPlayerSpawn(player);
+}
+
+void ModeEventRouter::onPlayerDeath(
+	IPlayer& player, IPlayer* killer, int reason)
+{
+	auto mode = Player::getPlayerExt(player)->getMode();
+	if (auto modeBase = this->modeManager.getMode(mode))
+		modeBase->onPlayerDeath(player, killer, reason);
+}
+
+void ModeEventRouter::onPlayerGiveDamage(IPlayer& player, IPlayer& to,
+	float amount, unsigned int weapon, BodyPart part)
+{
+	auto mode = Player::getPlayerExt(player)->getMode();
+	auto modeBase = this->modeManager.getMode(mode);
+	if (!modeBase)
+		return;
+
+	int slot = player.getID();
+	if (this->pending[slot] == 0.0)
+		this->dirty.push_back(slot);
+	this->pending[slot] += amount;
+	modeBase->onPlayerDamage(player, to, amount, weapon, part);
+}
+
+void ModeEventRouter::onPlayerKeyStateChange(
+	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
+{
+	auto mode = Player::getPlayerExt(player)->getMode();
+	if (auto modeBase = this->modeManager.getMode(mode))
+		modeBase->onPlayerKeyStateChange(player, newKeys, oldKeys);
+}
+}
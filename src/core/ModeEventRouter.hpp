@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Server/Components/Timers/timers.hpp>
+#include <player.hpp>
+#include <values.hpp>
+
+#include <array>
+#include <vector>
+
+namespace Core
+{
+class ModeManager;
+
+inline const auto DAMAGE_FLUSH_INTERVAL = Milliseconds(250);
+
+/// Subscribes once to the player events modes care about (spawns, deaths,
+/// damage and keys) and hands each one to the mode the player is in only,
+/// so modes neither register on their own nor check the mode of every
+/// event. The damage a player deals is summed up per slot and handed to
+/// their mode every DAMAGE_FLUSH_INTERVAL, so shotgun and minigun bursts
+/// don't touch the mode's player data per hit.
+class ModeEventRouter : public PlayerSpawnEventHandler,
+						public PlayerDamageEventHandler,
+						public PlayerChangeEventHandler
+{
+	ModeManager& modeManager;
+	IPlayerPool* playerPool;
+	ITimer* flushTimer = nullptr;
+	/// damage dealt by each slot since its last flush
+	std::array<float, PLAYER_POOL_SIZE> pending {};
+	/// slots that may have pending damage
+	std::vector<int> dirty;
+
+	void flush(IPlayer& player, int slot);
+
+public:
+	ModeEventRouter(ModeManager& modeManager, IPlayerPool* playerPool,
+		ITimersComponent* timersComponent);
+	~ModeEventRouter();
+
+	/// Hands the pending damage of every player to their modes
+	void flush();
+	/// Hands the player's pending damage to their mode, before they leave it
+	void flush(IPlayer& player);
+
+	void onPlayerSpawn(IPlayer& player) override;
+	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
+	void onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
+		unsigned int weapon, BodyPart part) override;
+	void onPlayerKeyStateChange(
+		IPlayer& player, uint32_t newKeys, uint32_t oldKeys) override;
+};
+}
@@ -1,43 +1,36 @@
 #include "ModeManager.hpp"
-#include <stdexcept>
 
 namespace Core
 {
 
 void ModeManager::removePlayerFromCurrentMode(IPlayer& player)
 {
-	auto mode = Player::getPlayerExt(player)->getMode();
-	if (mode == Modes::Mode::None)
+	auto modeBase = this->getMode(Player::getPlayerExt(player)->getMode());
+	if (!modeBase)
 		return;
-	std::shared_ptr<Modes::ModeBase> modeBase;
 
-	try
-	{
-		this->modes.at(mode)->onModeLeave(player);
-	}
-	catch (const std::out_of_range& e)
-	{
-		return;
-	}
+	this->eventRouter->flush(player);
+	modeBase->onModeLeave(player);
 }
 
-ModeManager::ModeManager(std::shared_ptr<DialogManager> dialogManager)
+ModeManager::ModeManager(std::shared_ptr<DialogManager> dialogManager,
+	IPlayerPool* playerPool, ITimersComponent* timersComponent)
 	: dialogManager(dialogManager)
+	, eventRouter(std::make_unique<ModeEventRouter>(
+		  *this, playerPool, timersComponent))
 {
 }
 
 void ModeManager::selectMode(IPlayer& player, Modes::Mode mode)
 {
-	try
-	{
-		this->modes.at(mode)->onModeSelect(player);
-	}
-	catch (const std::out_of_range& e)
+	auto modeBase = this->getMode(mode);
+	if (!modeBase)
 	{
 		Player::getPlayerExt(player)->sendErrorMessage(
 			__("Mode is not implemented yet!"));
 		return;
 	}
+	modeBase->onModeSelect(player);
 }
 
 bool ModeManager::joinMode(
@@ -56,58 +49,72 @@ bool ModeManager::joinMode(
 		= playerData->tempData->core->currentMode;
 	playerData->tempData->core->currentMode = mode;
 
-	try
-	{
-		this->modes.at(mode)->onModeJoin(player, joinData);
-	}
-	catch (const std::out_of_range& e)
+	auto modeBase = this->getMode(mode);
+	if (!modeBase)
 	{
 		Player::getPlayerExt(player)->sendErrorMessage(
 			__("Mode is not implemented yet!"));
 		return false;
 	}
+	modeBase->onModeJoin(player, joinData);
 
 	return true;
 }
 
 void ModeManager::addMode(std::unique_ptr<Modes::ModeBase> mode)
 {
-	this->modes[mode->getModeType()] = std::move(mode);
+	auto index = static_cast<std::size_t>(mode->getModeType());
+	this->modes[index] = std::move(mode);
 }
 
-void ModeManager::savePlayer(std::shared_ptr<PlayerModel> data, pqxx::work& txn)
+Modes::ModeBase* ModeManager::getMode(Modes::Mode mode)
 {
-	for (const auto& [_, mode] : this->modes)
+	auto index = static_cast<std::size_t>(mode);
+	return index < MODE_COUNT ? this->modes[index].get() : nullptr;
+}
+
+void ModeManager::flushDamage() { this->eventRouter->flush(); }
+
+void ModeManager::savePlayer(
+	std::shared_ptr<PlayerModel> data, cp::pipeline_batch& batch)
+{
+	for (const auto& mode : this->modes)
 	{
-		mode->onPlayerSave(data, txn);
+		if (mode)
+			mode->onPlayerSave(data, batch);
 	}
 }
 
 void ModeManager::loadPlayerData(
-	std::shared_ptr<PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<PlayerModel> data, cp::pipeline_batch& batch)
 {
-	for (const auto& [_, mode] : this->modes)
+	for (const auto& mode : this->modes)
 	{
-		mode->onPlayerLoad(data, txn);
+		if (mode)
+			mode->onPlayerLoad(data, batch);
 	}
 }
 
 void ModeManager::showModeSelectionDialog(IPlayer& player)
 {
-	auto dialog = std::shared_ptr<TabListHeadersDialog>(
-		new TabListHeadersDialog(_("Modes", player),
+	auto buildDialog = [&player]()
+	{
+		return std::shared_ptr<IDialog>(new TabListHeadersDialog(
+			_("Modes", player),
 			{ _("Mode", player), _("Command", player), _("Players", player) },
-			{ { _("Freeroam", player), "/fr",
-				  std::to_string(modes[Modes::Mode::Freeroam]->playerCount()) },
-				{ _("Deathmatch", player), "/dm",
-					std::to_string(
-						modes[Modes::Mode::Deathmatch]->playerCount()) },
+			{ { _("Freeroam", player), "/fr", DIALOG_SLOT },
+				{ _("Deathmatch", player), "/dm", DIALOG_SLOT },
 				{ _("Protect the President", player), "/ptp",
 					std::to_string(0) },
 				{ _("Derby", player), "/derby", std::to_string(0) },
 				{ _("Cops and Robbers", player), "/cnr", std::to_string(0) } },
 			_("Select", player), ""));
-	this->dialogManager->showDialog(player, dialog,
+	};
+	this->dialogManager->showDialog(player, DialogKind::ModeSelection,
+		buildDialog,
+		{ std::to_string(this->getMode(Modes::Mode::Freeroam)->playerCount()),
+			std::to_string(
+				this->getMode(Modes::Mode::Deathmatch)->playerCount()) },
 		[&](DialogResult result)
 		{
 			this->selectMode(
@@ -2,30 +2,49 @@
 
 #include "../modes/Modes.hpp"
 #include "../modes/ModeBase.hpp"
+#include "ModeEventRouter.hpp"
 #include "dialogs/DialogManager.hpp"
 #include "player.hpp"
 #include "player/PlayerModel.hpp"
+#include "utils/ConnectionPool.hpp"
 
+#include <Server/Components/Timers/timers.hpp>
+
+#include <array>
+#include <cstddef>
 #include <memory>
-#include <unordered_map>
 
 namespace Core
 {
+/// number of modes that can be implemented, Mode::None is the last one
+inline const std::size_t MODE_COUNT
+	= static_cast<std::size_t>(Modes::Mode::None);
+
 class ModeManager
 {
-	std::unordered_map<Modes::Mode, std::unique_ptr<Modes::ModeBase>> modes;
+	/// indexed by the mode, empty for modes that aren't implemented
+	std::array<std::unique_ptr<Modes::ModeBase>, MODE_COUNT> modes;
 
 	std::shared_ptr<DialogManager> dialogManager;
+	std::unique_ptr<ModeEventRouter> eventRouter;
 
 public:
-	ModeManager(std::shared_ptr<DialogManager> dialogManager);
+	ModeManager(std::shared_ptr<DialogManager> dialogManager,
+		IPlayerPool* playerPool, ITimersComponent* timersComponent);
 
 	void selectMode(IPlayer& player, Modes::Mode mode);
 	bool joinMode(
 		IPlayer& player, Modes::Mode mode, Modes::JoinData joinData = {});
 	void addMode(std::unique_ptr<Modes::ModeBase> mode);
-	void savePlayer(std::shared_ptr<PlayerModel> data, pqxx::work& txn);
-	void loadPlayerData(std::shared_ptr<PlayerModel> data, pqxx::work& txn);
+	/// nullptr if the mode isn't implemented
+	Modes::ModeBase* getMode(Modes::Mode mode);
+	/// Hands the damage dealt so far to the modes, for when they are about
+	/// to read it
+	void flushDamage();
+	void savePlayer(
+		std::shared_ptr<PlayerModel> data, cp::pipeline_batch& batch);
+	void loadPlayerData(
+		std::shared_ptr<PlayerModel> data, cp::pipeline_batch& batch);
 	void showModeSelectionDialog(IPlayer& player);
 	void removePlayerFromCurrentMode(IPlayer& player);
 };
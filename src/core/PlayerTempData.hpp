@@ -23,6 +23,8 @@ struct PlayerTempData
 	std::optional<std::shared_ptr<Modes::Duel::DuelOffer>> duelOfferSent;
 	std::unordered_map<int, std::shared_ptr<Modes::Duel::DuelOffer>>
 		duelOffersReceived;
+	// sender ids in the order the duel accept list dialog shows them
+	std::vector<int> duelAcceptList;
 
 	std::optional<std::shared_ptr<Modes::Duel::DuelOffer>>
 		temporaryDuelSettings;
@@ -0,0 +1,55 @@
+#include "RateLimiter.hpp"
+#include "player/PlayerExtension.hpp"
+
+#include <algorithm>
+
+namespace Core
+{
+RateLimiter::RateLimiter(IPlayerPool* playerPool)
+	: playerPool(playerPool)
+{
+	playerPool->getPlayerConnectDispatcher().addEventHandler(this);
+}
+
+RateLimiter::~RateLimiter()
+{
+	playerPool->getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+bool RateLimiter::consume(IPlayer& player, RateCategory category)
+{
+	const auto index = static_cast<std::size_t>(category);
+	const auto& budget = RATE_BUDGETS[index];
+	auto& bucket = this->buckets[player.getID()][index];
+
+	auto now = std::chrono::steady_clock::now();
+	std::chrono::duration<float> elapsed = now - bucket.updatedAt;
+	bucket.tokens = std::min(budget.capacity,
+		bucket.tokens + elapsed.count() * budget.refillPerSecond);
+	bucket.updatedAt = now;
+
+	if (bucket.tokens >= 1.0)
+	{
+		bucket.tokens -= 1.0;
+		bucket.warned = false;
+		return true;
+	}
+	if (!bucket.warned)
+	{
+		bucket.warned = true;
+		Player::getPlayerExt(player)->sendErrorMessage(
+			__("You are doing this too fast, slow down!"));
+	}
+	return false;
+}
+
+void RateLimiter::onPlayerConnect(IPlayer& player)
+{
+	auto now = std::chrono::steady_clock::now();
+	auto& buckets = this->buckets[player.getID()];
+	for (std::size_t i = 0; i < buckets.size(); i++)
+		buckets[i] = Bucket { .tokens = RATE_BUDGETS[i].capacity,
+			.warned = false,
+			.updatedAt = now };
+}
+}
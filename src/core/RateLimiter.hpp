@@ -0,0 +1,71 @@
+#pragma once
+
+#include <player.hpp>
+#include <values.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace Core
+{
+enum class RateCategory
+{
+	Chat,
+	ModeChat,
+	RoomChat,
+	LocalChat,
+	Command,
+	PrivateMessage,
+	DialogResponse,
+};
+
+inline const std::size_t RATE_CATEGORY_COUNT = 7;
+
+struct RateBudget
+{
+	/// how many actions can be done in a burst
+	float capacity;
+	/// how many actions a second are allowed in the long run
+	float refillPerSecond;
+};
+
+/// indexed by the category
+inline const auto RATE_BUDGETS = std::to_array<RateBudget>({
+	{ 3.0, 1.0 }, // chat
+	{ 4.0, 2.0 }, // mode chat
+	{ 4.0, 2.0 }, // room chat
+	{ 4.0, 2.0 }, // local chat
+	{ 10.0, 3.0 }, // commands
+	{ 3.0, 0.5 }, // private messages
+	{ 10.0, 5.0 }, // dialog responses
+});
+
+/// Flood control: a token bucket per player and category, kept in a flat
+/// array indexed by the player's slot. Every action takes a token and the
+/// buckets fill up again over time, so a check is a bit of arithmetic and
+/// never allocates. A player is warned once when a bucket runs dry, the
+/// rest of the flood is dropped silently.
+class RateLimiter : public PlayerConnectEventHandler
+{
+	struct Bucket
+	{
+		float tokens = 0.0;
+		bool warned = false;
+		std::chrono::steady_clock::time_point updatedAt;
+	};
+
+	IPlayerPool* playerPool;
+	std::array<std::array<Bucket, RATE_CATEGORY_COUNT>, PLAYER_POOL_SIZE>
+		buckets;
+
+public:
+	RateLimiter(IPlayerPool* playerPool);
+	~RateLimiter();
+
+	/// Takes a token for the action, false if the player has to wait
+	bool consume(IPlayer& player, RateCategory category);
+
+	void onPlayerConnect(IPlayer& player) override;
+};
+}
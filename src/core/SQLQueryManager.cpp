@@ -24,4 +24,10 @@ std::optional<const std::string> SQLQueryManager::getQueryByName(const std::stri
 	}
 	return {};
 }
+
+const std::unordered_map<std::string, const std::string>&
+SQLQueryManager::getQueries() const
+{
+	return this->_queries;
+}
 }
\ No newline at end of file
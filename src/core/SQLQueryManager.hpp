@@ -21,5 +21,6 @@ public:
 	SQLQueryManager();
 
 	std::optional<const std::string> getQueryByName(const std::string& name);
+	const std::unordered_map<std::string, const std::string>& getQueries() const;
 };
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "ServerStats.hpp"
+
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace Core
+{
+using namespace std::chrono;
+
+ServerStats::ServerStats(ICore* core, IPlayerPool* playerPool,
+	ITimersComponent* timersComponent, cp::connection_pool& connectionPool,
+	const CompletionQueue& completions)
+	: core(core)
+	, playerPool(playerPool)
+	, connectionPool(connectionPool)
+	, completions(completions)
+	, tickIntervalMetric(Utils::metrics().histogram(
+		  "oasis_tick_interval_seconds",
+		  "Time between server ticks", Utils::LATENCY_BUCKETS))
+	, playersMetric(
+		  Utils::metrics().gauge("oasis_players_online", "Players online"))
+	, windowStartedAt(steady_clock::now())
+	, lastPoolStats(connectionPool.stats())
+	, lastCompletionStats(completions.stats())
+{
+#ifdef OASIS_TRACK_ALLOCATIONS
+	this->lastTickAllocations = Utils::threadAllocations();
+#endif
+	this->core->getEventDispatcher().addEventHandler(this);
+	this->reportTimer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->report();
+			}),
+		SERVER_STATS_REPORT_INTERVAL, true);
+}
+
+ServerStats::~ServerStats()
+{
+	this->core->getEventDispatcher().removeEventHandler(this);
+	if (this->reportTimer)
+		this->reportTimer->kill();
+}
+
+void ServerStats::onTick(Microseconds elapsed, TimePoint now)
+{
+	this->ticks++;
+	this->tickInterval += elapsed;
+	this->maxTickInterval = std::max(this->maxTickInterval, elapsed);
+	this->peakPlayers
+		= std::max(this->peakPlayers, this->playerPool->players().size());
+	this->tickIntervalMetric.observe(elapsed);
+	this->playersMetric.set(this->playerPool->players().size());
+
+#ifdef OASIS_TRACK_ALLOCATIONS
+	// everything the main thread allocated since the previous tick
+	auto allocations = Utils::threadAllocations();
+	auto tickAllocations
+		= allocations.allocations - this->lastTickAllocations.allocations;
+	this->windowAllocations.allocations += tickAllocations;
+	this->windowAllocations.bytes
+		+= allocations.bytes - this->lastTickAllocations.bytes;
+	this->maxTickAllocations
+		= std::max(this->maxTickAllocations, tickAllocations);
+	this->lastTickAllocations = allocations;
+#endif
+}
+
+void ServerStats::report()
+{
+	auto now = steady_clock::now();
+	double seconds
+		= duration_cast<duration<double>>(now - this->windowStartedAt).count();
+	auto poolStats = this->connectionPool.stats();
+	auto borrows = poolStats.borrows - this->lastPoolStats.borrows;
+	auto statements = poolStats.statements - this->lastPoolStats.statements;
+	auto roundTrips = poolStats.round_trips - this->lastPoolStats.round_trips;
+	auto borrowWait = poolStats.borrow_wait - this->lastPoolStats.borrow_wait;
+	auto completionStats = this->completions.stats();
+
+	auto toMs = [](auto value)
+	{
+		return duration_cast<duration<double, std::milli>>(value).count();
+	};
+	spdlog::info("Server stats for the last {:.0f} s: {} ticks (tick interval "
+				 "avg {:.2f} ms, max {:.2f} ms), {} players (peak {})",
+		seconds, this->ticks,
+		this->ticks ? toMs(this->tickInterval) / this->ticks : 0.0,
+		toMs(this->maxTickInterval), this->playerPool->players().size(),
+		this->peakPlayers);
+	spdlog::info("Database: {}/{} connections ready, {:.1f} statements/s in "
+				 "{:.1f} round-trips/s, {:.1f} borrows/s (avg wait {:.2f} ms)",
+		poolStats.ready, poolStats.connections, statements / seconds,
+		roundTrips / seconds, borrows / seconds,
+		borrows ? toMs(borrowWait) / borrows : 0.0);
+	spdlog::info("Completions: {} posted, {} drained, {} pending, {} overflows",
+		completionStats.posted - this->lastCompletionStats.posted,
+		completionStats.drained - this->lastCompletionStats.drained,
+		completionStats.posted - completionStats.drained,
+		completionStats.overflows - this->lastCompletionStats.overflows);
+#ifdef OASIS_TRACK_ALLOCATIONS
+	auto ticks = std::max<std::size_t>(this->ticks, 1);
+	spdlog::info("Allocations: {:.1f} per tick ({:.0f} bytes), max {} in a "
+				 "single tick",
+		double(this->windowAllocations.allocations) / ticks,
+		double(this->windowAllocations.bytes) / ticks,
+		this->maxTickAllocations);
+	this->windowAllocations = {};
+	this->maxTickAllocations = 0;
+#endif
+
+	this->windowStartedAt = now;
+	this->ticks = 0;
+	this->tickInterval = Microseconds::zero();
+	this->maxTickInterval = Microseconds::zero();
+	this->peakPlayers = this->playerPool->players().size();
+	this->lastPoolStats = poolStats;
+	this->lastCompletionStats = completionStats;
+}
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CompletionQueue.hpp"
+#include "utils/AllocationTracker.hpp"
+#include "utils/ConnectionPool.hpp"
+#include "utils/Metrics.hpp"
+
+#include <Server/Components/Timers/timers.hpp>
+#include <core.hpp>
+#include <player.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Core
+{
+inline const auto SERVER_STATS_REPORT_INTERVAL = Seconds(60);
+
+/// Keeps track of how the server copes with its current load: how far apart
+/// ticks are, how many players are online and how busy the database is.
+/// The tick interval is all a tick handler can see, it grows when the
+/// server falls behind.
+/// A summary of the last window is logged every SERVER_STATS_REPORT_INTERVAL.
+class ServerStats : public CoreEventHandler
+{
+	ICore* core;
+	IPlayerPool* playerPool;
+	cp::connection_pool& connectionPool;
+	const CompletionQueue& completions;
+	ITimer* reportTimer = nullptr;
+	Utils::Histogram& tickIntervalMetric;
+	Utils::Gauge& playersMetric;
+
+	std::chrono::steady_clock::time_point windowStartedAt;
+	std::size_t ticks = 0;
+	Microseconds tickInterval {};
+	Microseconds maxTickInterval {};
+	std::size_t peakPlayers = 0;
+	cp::pool_stats lastPoolStats;
+	CompletionQueueStats lastCompletionStats;
+#ifdef OASIS_TRACK_ALLOCATIONS
+	Utils::AllocationCounters lastTickAllocations;
+	Utils::AllocationCounters windowAllocations;
+	std::uint64_t maxTickAllocations = 0;
+#endif
+
+	void report();
+
+public:
+	ServerStats(ICore* core, IPlayerPool* playerPool,
+		ITimersComponent* timersComponent, cp::connection_pool& connectionPool,
+		const CompletionQueue& completions);
+	~ServerStats();
+
+	void onTick(Microseconds elapsed, TimePoint now) override;
+};
+}
@@ -0,0 +1,188 @@
+#include "StartupScheduler.hpp"
+
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+namespace Core
+{
+using namespace std::chrono;
+
+StartupScheduler::StartupScheduler(ITimersComponent* timersComponent)
+	: timersComponent(timersComponent)
+	, startedAt(steady_clock::now())
+{
+}
+
+StartupScheduler::~StartupScheduler()
+{
+	for (auto& phase : this->phases)
+	{
+		if (phase.timer)
+			phase.timer->kill();
+		if (phase.result.valid())
+			phase.result.wait();
+	}
+}
+
+StartupPhase& StartupScheduler::addPhase(
+	const std::string& name, StartupPhaseKind kind)
+{
+	auto& phase = this->phases.emplace_back();
+	phase.name = name;
+	phase.kind = kind;
+	phase.startedAt = steady_clock::now();
+	return phase;
+}
+
+void StartupScheduler::finishPhase(StartupPhase& phase)
+{
+	phase.finished = true;
+	spdlog::debug("Startup phase '{}' finished in {} ms", phase.name,
+		duration_cast<milliseconds>(phase.finishedAt - phase.startedAt)
+			.count());
+	this->reportIfDone();
+}
+
+void StartupScheduler::run(
+	const std::string& name, std::function<void()> step)
+{
+	auto& phase = this->addPhase(name, StartupPhaseKind::Sync);
+	step();
+	phase.finishedAt = steady_clock::now();
+	this->finishPhase(phase);
+}
+
+void StartupScheduler::runAsync(
+	const std::string& name, std::function<void()> step)
+{
+	auto& phase = this->addPhase(name, StartupPhaseKind::Async);
+	phase.result = std::async(std::launch::async,
+		[&phase, step = std::move(step)]()
+		{
+			try
+			{
+				step();
+			}
+			catch (...)
+			{
+				phase.finishedAt = steady_clock::now();
+				throw;
+			}
+			phase.finishedAt = steady_clock::now();
+		});
+}
+
+void StartupScheduler::runSliced(const std::string& name, std::size_t count,
+	std::size_t batchSize, std::function<void(std::size_t)> step)
+{
+	auto& phase = this->addPhase(name, StartupPhaseKind::Sliced);
+	auto next = std::make_shared<std::size_t>(0);
+	auto runBatch = [&phase, next, count, batchSize, step]()
+	{
+		std::size_t end
+			= std::min(count, *next + std::max<std::size_t>(batchSize, 1));
+		for (; *next < end; (*next)++)
+			step(*next);
+		phase.ticks++;
+
+		if (*next < count)
+			return false;
+		phase.finishedAt = steady_clock::now();
+		return true;
+	};
+
+	// first batch goes out right away, the rest on the following ticks
+	if (runBatch())
+	{
+		this->finishPhase(phase);
+		return;
+	}
+	phase.timer = this->timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this, &phase, runBatch]()
+			{
+				if (!runBatch())
+					return;
+				phase.timer->kill();
+				phase.timer = nullptr;
+				this->finishPhase(phase);
+			}),
+		STARTUP_SLICE_INTERVAL, true);
+}
+
+StartupPhase& StartupScheduler::findAsyncPhase(const std::string& name)
+{
+	auto phase = std::find_if(this->phases.begin(), this->phases.end(),
+		[&name](const StartupPhase& phase)
+		{
+			return phase.name == name;
+		});
+	if (phase == this->phases.end() || phase->kind != StartupPhaseKind::Async)
+		throw std::invalid_argument("Unknown async startup phase: " + name);
+	return *phase;
+}
+
+void StartupScheduler::wait(const std::string& name)
+{
+	auto& phase = this->findAsyncPhase(name);
+	if (phase.finished)
+		return;
+	phase.result.get();
+	this->finishPhase(phase);
+}
+
+void StartupScheduler::check(const std::string& name)
+{
+	auto& phase = this->findAsyncPhase(name);
+	if (phase.finished
+		|| phase.result.wait_for(seconds(0)) != std::future_status::ready)
+		return;
+	phase.result.get();
+	this->finishPhase(phase);
+}
+
+void StartupScheduler::seal()
+{
+	this->sealed = true;
+	this->reportIfDone();
+}
+
+void StartupScheduler::reportIfDone()
+{
+	if (!this->sealed || this->reported)
+		return;
+	for (const auto& phase : this->phases)
+	{
+		if (!phase.finished)
+			return;
+	}
+	this->reported = true;
+
+	auto finishedAt = this->startedAt;
+	for (const auto& phase : this->phases)
+		finishedAt = std::max(finishedAt, phase.finishedAt);
+
+	spdlog::info("Startup timeline (total {} ms):",
+		duration_cast<milliseconds>(finishedAt - this->startedAt).count());
+	for (const auto& phase : this->phases)
+	{
+		auto offset
+			= duration_cast<milliseconds>(phase.startedAt - this->startedAt);
+		auto duration
+			= duration_cast<milliseconds>(phase.finishedAt - phase.startedAt);
+		if (phase.kind == StartupPhaseKind::Sliced)
+			spdlog::info("  +{:>5} ms  {:<24} {:>5} ms  ({}, {} ticks)",
+				offset.count(), phase.name, duration.count(),
+				magic_enum::enum_name(phase.kind), phase.ticks);
+		else
+			spdlog::info("  +{:>5} ms  {:<24} {:>5} ms  ({})", offset.count(),
+				phase.name, duration.count(),
+				magic_enum::enum_name(phase.kind));
+	}
+}
+}
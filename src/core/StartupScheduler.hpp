@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Server/Components/Timers/timers.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <list>
+#include <string>
+
+namespace Core
+{
+inline const auto STARTUP_SLICE_INTERVAL = Milliseconds(10);
+
+enum class StartupPhaseKind
+{
+	Sync,
+	Async,
+	Sliced
+};
+
+struct StartupPhase
+{
+	std::string name;
+	StartupPhaseKind kind;
+	std::chrono::steady_clock::time_point startedAt;
+	std::chrono::steady_clock::time_point finishedAt;
+	bool finished = false;
+
+	/// Async phases only
+	std::future<void> result;
+	/// Sliced phases only
+	ITimer* timer = nullptr;
+	std::size_t ticks = 0;
+};
+
+/// Runs server start-up work as named phases and logs a timeline with the
+/// duration of each of them once everything has completed.
+/// - sync phases run right away on the main thread
+/// - async phases run on a worker thread alongside everything else
+/// - sliced phases are spread over several server ticks in fixed batches
+class StartupScheduler
+{
+	ITimersComponent* timersComponent;
+	std::chrono::steady_clock::time_point startedAt;
+	std::list<StartupPhase> phases;
+	bool sealed = false;
+	bool reported = false;
+
+	StartupPhase& addPhase(const std::string& name, StartupPhaseKind kind);
+	StartupPhase& findAsyncPhase(const std::string& name);
+	void finishPhase(StartupPhase& phase);
+	void reportIfDone();
+
+public:
+	StartupScheduler(ITimersComponent* timersComponent);
+	~StartupScheduler();
+
+	void run(const std::string& name, std::function<void()> step);
+	void runAsync(const std::string& name, std::function<void()> step);
+	void runSliced(const std::string& name, std::size_t count,
+		std::size_t batchSize, std::function<void(std::size_t)> step);
+
+	/// Blocks until the async phase is done, rethrowing its exception
+	void wait(const std::string& name);
+	/// Rethrows the exception of the async phase if it has already failed,
+	/// without waiting for it otherwise
+	void check(const std::string& name);
+	/// Marks that no more phases will be added, so the timeline can be
+	/// reported as soon as the remaining ones finish
+	void seal();
+};
+}
@@ -3,6 +3,7 @@
 #include "../SQLQueryManager.hpp"
 #include "../utils/QueryNames.hpp"
 #include "../utils/Argon2idHash.hpp"
+#include "../utils/Logging.hpp"
 #include "../player/PlayerExtension.hpp"
 
 #include <fmt/printf.h>
@@ -11,21 +12,27 @@
 #include <spdlog/spdlog.h>
 #include <component.hpp>
 
+#include <exception>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <utility>
 
 namespace Core::Auth
 {
 AuthController::AuthController(IComponentList* components,
 	IPlayerPool* playerPool, cp::connection_pool& pool,
 	std::weak_ptr<ModeManager> modeManager,
-	std::shared_ptr<DialogManager> dialogManager)
+	std::shared_ptr<DialogManager> dialogManager,
+	std::shared_ptr<CompletionQueue> completions)
 	: playerPool(playerPool)
 	, classesComponent(components->queryComponent<IClassesComponent>())
 	, timersComponent(components->queryComponent<ITimersComponent>())
 	, modeManager(modeManager)
 	, dialogManager(dialogManager)
 	, pool(pool)
+	, completions(completions)
+	, passwordWorkers(PASSWORD_WORKER_COUNT)
 {
 	playerPool->getPlayerConnectDispatcher().addEventHandler(this);
 }
@@ -78,7 +85,7 @@ void AuthController::showRegistrationDialog(IPlayer& player)
 			{
 			case DialogResponse_Left:
 			{
-				onPasswordSubmit(player, result.inputText());
+				onPasswordSubmit(player, std::string(result.inputText()));
 				break;
 			}
 			case DialogResponse_Right:
@@ -129,7 +136,7 @@ void AuthController::showLoginDialog(IPlayer& player, bool wrongPass)
 			{
 			case DialogResponse_Left:
 			{
-				onLoginSubmit(player, result.inputText());
+				onLoginSubmit(player, std::string(result.inputText()));
 				break;
 			}
 			case DialogResponse_Right:
@@ -141,21 +148,85 @@ void AuthController::showLoginDialog(IPlayer& player, bool wrongPass)
 		});
 }
 
+// argon2 is slow on purpose, so it runs on one of the password workers and
+// the result is handed back through the completion queue. It's dropped if the
+// player has left by then, even if someone else got the same id in the
+// meantime.
+template <typename Job, typename Then>
+void AuthController::runPasswordJob(IPlayer& player, Job job, Then then)
+{
+	this->passwordWorkers.post(
+		[completions = this->completions, playerPool = this->playerPool,
+			playerId = player.getID(),
+			data = std::weak_ptr<PlayerModel>(Player::getPlayerData(player)),
+			job = std::move(job), then = std::move(then)]() mutable
+		{
+			std::optional<decltype(job())> result;
+			try
+			{
+				result = job();
+			}
+			catch (const std::exception& e)
+			{
+				spdlog::error("Password job failed: {}", e.what());
+			}
+
+			completions->post(
+				[playerPool, playerId, data = std::move(data),
+					result = std::move(result),
+					then = std::move(then)]() mutable
+				{
+					auto player = playerPool->get(playerId);
+					if (!player || data.expired()
+						|| Player::getPlayerData(*player) != data.lock())
+						return;
+					if (!result)
+					{
+						auto playerExt = Player::getPlayerExt(*player);
+						playerExt->sendErrorMessage(
+							__("Something went wrong, please try again later"));
+						playerExt->delayedKick();
+						return;
+					}
+					then(*player, std::move(*result));
+				});
+		});
+}
+
 void AuthController::onLoginSubmit(IPlayer& player, const std::string& password)
 {
-	auto playerData = Player::getPlayerData(player);
-	auto playerExt = Player::getPlayerExt(player);
-	if (password.length() > 5)
+	if (password.length() <= 5)
 	{
-		if (Utils::argon2VerifyEncodedHash(playerData->passwordHash, password))
+		this->onLoginFailed(player);
+		return;
+	}
+
+	this->runPasswordJob(
+		player,
+		[hash = Player::getPlayerData(player)->passwordHash, password]()
+		{
+			return Utils::argon2VerifyEncodedHash(hash, password);
+		},
+		[this](IPlayer& player, bool matches)
 		{
+			if (!matches)
+			{
+				this->onLoginFailed(player);
+				return;
+			}
+			auto playerData = Player::getPlayerData(player);
+			auto playerExt = Player::getPlayerExt(player);
 			playerExt->sendInfoMessage(__("You have been logged in!"));
 			playerData->lastLoginAt = Utils::SQL::get_current_timestamp();
 			playerData->lastIP = playerExt->getIP();
 			this->onPlayerLoggedIn(player);
-			return;
-		}
-	}
+		});
+}
+
+void AuthController::onLoginFailed(IPlayer& player)
+{
+	auto playerData = Player::getPlayerData(player);
+	auto playerExt = Player::getPlayerExt(player);
 	int loginAttempts = playerData->tempData->auth->loginAttempts;
 	playerData->tempData->auth->loginAttempts = ++loginAttempts;
 	if (loginAttempts > 3)
@@ -177,11 +248,20 @@ void AuthController::onPasswordSubmit(
 		this->showRegistrationDialog(player);
 		return;
 	}
-	auto hashedPassword = Utils::argon2HashPassword(password);
-	auto playerData = Player::getPlayerData(player);
-	playerData->passwordHash = hashedPassword;
-	this->showEmailDialog(player);
-	playerData->tempData->auth->plainTextPassword = password;
+	Player::getPlayerData(player)->tempData->auth->plainTextPassword
+		= password;
+	this->runPasswordJob(
+		player,
+		[password]()
+		{
+			return Utils::argon2HashPassword(password);
+		},
+		[this](IPlayer& player, std::string hashedPassword)
+		{
+			Player::getPlayerData(player)->passwordHash
+				= std::move(hashedPassword);
+			this->showEmailDialog(player);
+		});
 }
 
 void AuthController::onRegistrationSubmit(IPlayer& player)
@@ -276,7 +356,7 @@ void AuthController::showEmailDialog(IPlayer& player)
 			{
 			case DialogResponse_Left:
 			{
-				onEmailSubmit(player, result.inputText());
+				onEmailSubmit(player, std::string(result.inputText()));
 				break;
 			}
 			case DialogResponse_Right:
@@ -352,26 +432,26 @@ bool AuthController::loadPlayerData(IPlayer& player)
 	{
 		return false;
 	}
-	spdlog::info(
-		"Found player data for " + player.getName().to_string() + " in DB");
+	OASIS_LOG_LIMITED(spdlog::level::info, Utils::LOG_PLAYER_EVENTS_LIMIT,
+		"Found player data for {} in DB", player.getName().to_string());
 
 	auto row = res[0];
 	auto data = Player::getPlayerData(player);
 	data->updateFromRow(row);
 
-	cp::query loadPlayerSettingsQuery(SQLQueryManager::Get()
-			->getQueryByName(Utils::SQL::Queries::LOAD_PLAYER_SETTINGS)
-			.value());
-	auto tx_s = cp::tx(this->pool, loadPlayerSettingsQuery);
-	pqxx::result res_s = loadPlayerSettingsQuery(data->userId);
-
-	auto row_s = res_s[0];
-	data->settings->updateFromRow(row_s);
-
-	this->modeManager.lock()->loadPlayerData(data, tx.get());
+	{
+		cp::pipeline_batch batch(tx);
+		batch.exec_prepared_then(Utils::SQL::Queries::LOAD_PLAYER_SETTINGS,
+			[data](const pqxx::result& result)
+			{
+				data->settings->updateFromRow(result[0]);
+			},
+			data->userId);
+		this->modeManager.lock()->loadPlayerData(data, batch);
+		batch.flush();
+	}
 
 	tx.commit();
-	tx_s.commit();
 
 	return true;
 }
@@ -1,13 +1,16 @@
 #pragma once
 
+#include "../CompletionQueue.hpp"
 #include "../dialogs/DialogManager.hpp"
 #include "../ModeManager.hpp"
 #include "../utils/ConnectionPool.hpp"
+#include "../utils/WorkerPool.hpp"
 
 #include <Server/Components/Timers/timers.hpp>
 #include <Server/Components/Classes/classes.hpp>
 #include <player.hpp>
 
+#include <cstddef>
 #include <regex>
 #include <memory>
 
@@ -17,13 +20,18 @@ inline const std::regex EMAIL_REGEX(
 	"(?:(?:[^<>()\\[\\].,;:\\s@\"]+(?:\\.[^<>()\\[\\].,;:\\s@\"]+)*)|\".+\")@(?"
 	":(?:[^<>()‌​\\[\\].,;:\\s@\"]+\\.)+[^<>()\\[\\].,;:\\s@\"]{2,})");
 
+/// argon2 is memory-hard, a couple of threads are enough to hash for a full
+/// server without letting a wave of logins eat all of its memory
+inline const std::size_t PASSWORD_WORKER_COUNT = 2;
+
 class AuthController : public PlayerConnectEventHandler,
 					   public ClassEventHandler
 {
 public:
 	AuthController(IComponentList* components, IPlayerPool* playerPool,
 		cp::connection_pool& pool, std::weak_ptr<ModeManager> modeManager,
-		std::shared_ptr<DialogManager> dialogManager);
+		std::shared_ptr<DialogManager> dialogManager,
+		std::shared_ptr<CompletionQueue> completions);
 	~AuthController();
 
 	void onPlayerConnect(IPlayer& player) override;
@@ -35,7 +43,10 @@ private:
 	std::shared_ptr<DialogManager> dialogManager;
 	std::weak_ptr<ModeManager> modeManager;
 	cp::connection_pool& pool;
+	std::shared_ptr<CompletionQueue> completions;
 	// std::weak_ptr<Core::CoreManager> _coreManager;
+	// last, so it's joined before anything its jobs use goes away
+	Utils::WorkerPool passwordWorkers;
 
 	void showLanguageDialog(IPlayer& player);
 	void showRegistrationDialog(IPlayer& player);
@@ -44,9 +55,12 @@ private:
 	void showRegistrationInfoDialog(IPlayer& player);
 	void interpolatePlayerCamera(IPlayer& player);
 	bool loadPlayerData(IPlayer& player);
+	template <typename Job, typename Then>
+	void runPasswordJob(IPlayer& player, Job job, Then then);
 
 	// Callbacks
 	void onLoginSubmit(IPlayer& player, const std::string& password);
+	void onLoginFailed(IPlayer& player);
 	void onPasswordSubmit(IPlayer& player, const std::string& password);
 	void onEmailSubmit(IPlayer& player, const std::string& email);
 	void onRegistrationSubmit(IPlayer& player);
@@ -1,20 +1,28 @@
 #include "CommandManager.hpp"
+#include "../utils/AllocationTracker.hpp"
+#include "../utils/Logging.hpp"
 #include "../utils/Strings.hpp"
 #include "../player/PlayerExtension.hpp"
 #include "CommandInfo.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <functional>
 #include <spdlog/spdlog.h>
 #include <player.hpp>
 #include <stdexcept>
+#include <string_view>
 #include <variant>
 
 namespace Core::Commands
 {
 
-CommandManager::CommandManager(IPlayerPool* playerPool)
+CommandManager::CommandManager(
+	IPlayerPool* playerPool, std::shared_ptr<RateLimiter> rateLimiter)
 	: _playerPool(playerPool)
+	, rateLimiter(rateLimiter)
+	, commandsRun(Utils::metrics().counter(
+		  "oasis_commands_total", "Commands typed by logged in players"))
 {
 	_playerPool->getPlayerTextDispatcher().addEventHandler(this);
 }
@@ -27,28 +35,33 @@ CommandManager::~CommandManager()
 bool CommandManager::onPlayerCommandText(
 	IPlayer& player, StringView commandText)
 {
+	OASIS_ALLOCATION_SCOPE("onPlayerCommandText");
 	auto playerExt = Player::getPlayerExt(player);
 	if (!playerExt->isAuthorized())
 		return true;
+	// before any parsing, a flood shouldn't cost more than this check
+	if (!this->rateLimiter->consume(player, RateCategory::Command))
+		return true;
 
-	auto preparedCommandText = commandText.to_string();
-	auto cmdParts = Utils::Strings::split(preparedCommandText, ' ');
-	assert(!cmdParts.empty());
-
-	// get command name and pop the first element from the vector
-	auto commandName = cmdParts.at(0);
-	preparedCommandText.erase(0, commandName.size());
-	Utils::Strings::trim(preparedCommandText);
-	commandName.erase(0, 1); // remove '/' from command name
-
-	if (!this->_commandHandlers.contains(commandName))
+	// "/name args..." - the name runs up to the first space, the rest
+	// goes to the handlers trimmed
+	std::string_view text(commandText.data(), commandText.size());
+	if (text.empty())
+		return false;
+	this->commandsRun.increment();
+	auto nameEnd = std::min(text.find(' '), text.size());
+	auto commandName = std::string(text.substr(1, nameEnd - 1));
+	auto handlers = this->_commandHandlers.find(commandName);
+	if (handlers == this->_commandHandlers.end())
 	{
 		return false;
 	}
+	auto commandArgs
+		= std::string(Utils::Strings::trim_view(text.substr(nameEnd)));
 
 	try
 	{
-		this->callCommandHandler(player, commandName, preparedCommandText);
+		this->callCommandHandler(player, handlers->second, commandArgs);
 	}
 	catch (const std::invalid_argument& e)
 	{
@@ -56,7 +69,9 @@ bool CommandManager::onPlayerCommandText(
 	}
 	catch (const std::exception& e)
 	{
-		spdlog::debug("Failed to invoke command: {}", e.what());
+		OASIS_LOG_LIMITED(spdlog::level::debug,
+			Utils::LOG_PLAYER_EVENTS_LIMIT, "Failed to invoke command: {}",
+			e.what());
 		Player::getPlayerExt(player)->sendErrorMessage(
 			__("Failed to invoke command!"));
 	}
@@ -64,10 +79,11 @@ bool CommandManager::onPlayerCommandText(
 }
 
 void CommandManager::callCommandHandler(IPlayer& player,
-	const std::string& cmdName, std::string preparedCommandArgs)
+	const std::vector<std::function<HandlerSignature>>& handlers,
+	const std::string& preparedCommandArgs)
 {
 	bool notFound = true;
-	for (const auto& handler : this->_commandHandlers[cmdName])
+	for (const auto& handler : handlers)
 	{
 		try
 		{
@@ -77,7 +93,9 @@ void CommandManager::callCommandHandler(IPlayer& player,
 		}
 		catch (const std::exception& e)
 		{
-			spdlog::debug(e.what());
+			OASIS_LOG_LIMITED(spdlog::level::debug,
+				Utils::LOG_PLAYER_EVENTS_LIMIT, "Command handler failed: {}",
+				e.what());
 			continue;
 		}
 		notFound = false;
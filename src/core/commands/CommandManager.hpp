@@ -1,6 +1,8 @@
 #pragma once
 
 #include "CommandInfo.hpp"
+#include "../RateLimiter.hpp"
+#include "../utils/Metrics.hpp"
 
 #include <functional>
 #include <player.hpp>
@@ -8,6 +10,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Core::Commands
 {
@@ -46,13 +49,17 @@ class CommandManager : public PlayerTextEventHandler
 	std::unordered_map<std::string, std::vector<std::shared_ptr<CommandInfo>>>
 		_commandCategories;
 	IPlayerPool* _playerPool;
+	std::shared_ptr<RateLimiter> rateLimiter;
+	Utils::Counter& commandsRun;
 
-	void callCommandHandler(IPlayer& player, const std::string& cmdName,
-		std::string preparedCommandArgs);
+	void callCommandHandler(IPlayer& player,
+		const std::vector<std::function<HandlerSignature>>& handlers,
+		const std::string& preparedCommandArgs);
 	void sendCommandUsage(IPlayer& player, const std::string& name);
 
 public:
-	CommandManager(IPlayerPool* playerPool);
+	CommandManager(
+		IPlayerPool* playerPool, std::shared_ptr<RateLimiter> rateLimiter);
 	~CommandManager();
 
 	template <MatchesSignature F>
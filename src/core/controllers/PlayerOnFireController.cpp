@@ -1,5 +1,6 @@
 #include "PlayerOnFireController.hpp"
 
+#include "../DeferredQueue.hpp"
 #include "../player/PlayerExtension.hpp"
 #include "../utils/Events.hpp"
 
@@ -58,7 +59,7 @@ void PlayerOnFireController::initCommands()
 }
 
 PlayerOnFireController::PlayerOnFireController(IPlayerPool* playerPool,
-	std::shared_ptr<dp::event_bus> bus,
+	std::shared_ptr<Core::Utils::EventBus> bus,
 	std::shared_ptr<Commands::CommandManager> commandManager,
 	std::shared_ptr<DialogManager> dialogManager)
 	: bus(bus)
@@ -80,28 +81,58 @@ void PlayerOnFireController::onPlayerDeath(
 {
 	auto killeeData = Player::getPlayerData(player);
 	auto killeeExt = Player::getPlayerExt(player);
-	if (this->playersOnFire.contains(&player))
-		this->bus->fire_event(
-			Utils::Events::PlayerOnFireBeenKilled { .player = player,
-				.killer = *killer,
-				.mode = killeeExt->getMode() });
+	auto deferred = DeferredQueue::Get();
+	if (killer && this->playersOnFire.contains(player))
+	{
+		deferred->post(
+			[this, player = Player::PlayerHandle::of(player),
+				killer = Player::PlayerHandle::of(*killer),
+				mode = killeeExt->getMode()](IPlayerPool& playerPool)
+			{
+				auto killee = player.get();
+				auto killerPlayer = killer.get();
+				if (killee && killerPlayer)
+					this->bus->fire(Utils::Events::PlayerOnFireBeenKilled {
+						.player = *killee,
+						.killer = *killerPlayer,
+						.mode = mode });
+			});
+	}
 	killeeData->tempData->core->subsequentKills = 0;
-	player.setWantedLevel(0);
-	this->playersOnFire.erase(&player);
+	deferred->post(player, DeferredKey::WantedLevel,
+		[](IPlayer& player)
+		{
+			player.setWantedLevel(0);
+		});
+	this->playersOnFire.erase(player);
 
 	if (killer == nullptr)
 		return;
 	auto killerData = Player::getPlayerData(*killer);
 	auto killerExt = Player::getPlayerExt(*killer);
 	auto kills = ++killerData->tempData->core->subsequentKills;
-	killer->setWantedLevel(kills);
+	deferred->post(*killer, DeferredKey::WantedLevel,
+		[kills](IPlayer& killer)
+		{
+			killer.setWantedLevel(kills);
+		});
 	if (kills == 6)
 	{
-		this->bus->fire_event(
-			Utils::Events::PlayerOnFireEvent { .player = *killer,
-				.lastKillee = player,
-				.mode = killerExt->getMode() });
-		this->playersOnFire.emplace(killer);
+		deferred->post(
+			[this, player = Player::PlayerHandle::of(player),
+				killer = Player::PlayerHandle::of(*killer),
+				mode = killerExt->getMode()](IPlayerPool& playerPool)
+			{
+				auto killee = player.get();
+				auto killerPlayer = killer.get();
+				if (killee && killerPlayer)
+					this->bus->fire(
+						Utils::Events::PlayerOnFireEvent {
+							.player = *killerPlayer,
+							.lastKillee = *killee,
+							.mode = mode });
+			});
+		this->playersOnFire.insert(*killer);
 	}
 }
 
@@ -109,7 +140,7 @@ void PlayerOnFireController::onPlayerDisconnect(
 	IPlayer& player, PeerDisconnectReason reason)
 {
 	auto playerExt = Player::getPlayerExt(player);
-	this->playersOnFire.erase(&player);
+	this->playersOnFire.erase(player);
 }
 
 }
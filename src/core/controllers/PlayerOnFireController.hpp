@@ -1,25 +1,24 @@
 #pragma once
 
 #include "../../modes/Modes.hpp"
-#include "../utils/Events.hpp"
+#include "../utils/EventBus.hpp"
 #include "../commands/CommandManager.hpp"
 #include "../dialogs/DialogManager.hpp"
+#include "../player/PlayerSet.hpp"
 
-#include <eventbus/event_bus.hpp>
 #include <player.hpp>
 
 #include <memory>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace Core::Controllers
 {
 class PlayerOnFireController : public PlayerDamageEventHandler,
 							   public PlayerConnectEventHandler
 {
-	std::shared_ptr<dp::event_bus> bus;
+	std::shared_ptr<Core::Utils::EventBus> bus;
 	IPlayerPool* playerPool;
-	std::unordered_set<IPlayer*> playersOnFire;
+	Player::PlayerSet playersOnFire;
 	std::shared_ptr<Commands::CommandManager> commandManager;
 	std::shared_ptr<DialogManager> dialogManager;
 
@@ -27,7 +26,7 @@ class PlayerOnFireController : public PlayerDamageEventHandler,
 
 public:
 	PlayerOnFireController(IPlayerPool* playerPool,
-		std::shared_ptr<dp::event_bus> bus,
+		std::shared_ptr<Core::Utils::EventBus> bus,
 		std::shared_ptr<Commands::CommandManager> commandManager,
 		std::shared_ptr<DialogManager> dialogManager);
 	~PlayerOnFireController();
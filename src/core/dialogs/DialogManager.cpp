@@ -1,12 +1,20 @@
 #include "DialogManager.hpp"
 #include "DialogResult.hpp"
 #include "IDialog.hpp"
+#include "../player/PlayerExtension.hpp"
+#include "../utils/AllocationTracker.hpp"
 #include <memory>
+#include <string_view>
+#include <utility>
 
 namespace Core
 {
 
-DialogManager::DialogManager(IComponentList* components)
+DialogManager::DialogManager(
+	IComponentList* components, std::shared_ptr<RateLimiter> rateLimiter)
+	: rateLimiter(rateLimiter)
+	, dialogsShown(Utils::metrics().counter(
+		  "oasis_dialogs_shown_total", "Dialogs shown to players"))
 {
 	IDialogsComponent* dialogsComponent
 		= components->queryComponent<IDialogsComponent>();
@@ -24,16 +32,31 @@ void DialogManager::onDialogResponse(IPlayer& player, int dialogId,
 {
 	if (dialogId != MAGIC_DIALOG_ID)
 		return;
+	OASIS_ALLOCATION_SCOPE("onDialogResponse");
+	if (!this->rateLimiter->consume(player, RateCategory::DialogResponse))
+	{
+		// the client has closed the dialog already, without putting it back
+		// the player would be stuck, e.g. on the login dialog
+		const auto& shown = this->shown[player.getID()];
+		if (this->dialogs[player.getID()])
+			queryExtension<IPlayerDialogData>(player)->show(player,
+				MAGIC_DIALOG_ID, shown.style, shown.title, shown.content,
+				shown.button1, shown.button2);
+		return;
+	}
 
-	if (this->dialogs.count(player.getID()) == 0)
+	// taken out of the slot first, the callback may well show another dialog
+	auto callback = std::move(this->dialogs[player.getID()]);
+	if (!callback)
 		return;
 
-	this->dialogs[player.getID()](
-		DialogResult(response, listItem, inputText.to_string()));
+	callback(DialogResult(response, listItem,
+		std::string_view(inputText.data(), inputText.size())));
 }
 
 void DialogManager::hideDialog(IPlayer& player)
 {
+	this->dialogs[player.getID()] = nullptr;
 	IPlayerDialogData* dialogData = queryExtension<IPlayerDialogData>(player);
 	dialogData->hide(player);
 }
@@ -42,28 +65,28 @@ void DialogManager::showDialog(IPlayer& player,
 	std::shared_ptr<InputDialog> dialog, DialogManager::Callback callback)
 {
 	this->showDialog(
-		player, std::static_pointer_cast<IDialog>(dialog), callback);
+		player, std::static_pointer_cast<IDialog>(dialog), std::move(callback));
 }
 
 void DialogManager::showDialog(IPlayer& player,
 	std::shared_ptr<ListDialog> dialog, DialogManager::Callback callback)
 {
 	this->showDialog(
-		player, std::static_pointer_cast<IDialog>(dialog), callback);
+		player, std::static_pointer_cast<IDialog>(dialog), std::move(callback));
 }
 
 void DialogManager::showDialog(IPlayer& player,
 	std::shared_ptr<MessageDialog> dialog, DialogManager::Callback callback)
 {
 	this->showDialog(
-		player, std::static_pointer_cast<IDialog>(dialog), callback);
+		player, std::static_pointer_cast<IDialog>(dialog), std::move(callback));
 }
 
 void DialogManager::showDialog(IPlayer& player,
 	std::shared_ptr<TabListDialog> dialog, DialogManager::Callback callback)
 {
 	this->showDialog(
-		player, std::static_pointer_cast<IDialog>(dialog), callback);
+		player, std::static_pointer_cast<IDialog>(dialog), std::move(callback));
 }
 
 void DialogManager::showDialog(IPlayer& player,
@@ -71,17 +94,49 @@ void DialogManager::showDialog(IPlayer& player,
 	DialogManager::Callback callback)
 {
 	this->showDialog(
-		player, std::static_pointer_cast<IDialog>(dialog), callback);
+		player, std::static_pointer_cast<IDialog>(dialog), std::move(callback));
+}
+
+void DialogManager::showDialog(IPlayer& player, DialogKind kind,
+	const TemplateBuilder& builder,
+	std::initializer_list<std::string_view> values,
+	DialogManager::Callback callback)
+{
+	auto key = std::make_pair(kind, Player::getPlayerData(player)->language);
+	auto cached = this->templates.find(key);
+	if (cached == this->templates.end())
+		cached = this->templates.emplace(key, DialogTemplate(*builder())).first;
+
+	const auto& dialog = cached->second;
+	dialog.render(this->renderBuffer, values);
+	this->dialogs[player.getID()] = std::move(callback);
+	this->show(player, dialog.style, dialog.title, this->renderBuffer,
+		dialog.button1, dialog.button2);
 }
 
 void DialogManager::showDialog(IPlayer& player, std::shared_ptr<IDialog> dialog,
 	DialogManager::Callback callback)
 {
-	this->dialogs[player.getID()] = callback;
+	this->dialogs[player.getID()] = std::move(callback);
+	this->show(player, dialog->style, dialog->title, dialog->content,
+		dialog->button1, dialog->button2);
+}
+
+void DialogManager::show(IPlayer& player, DialogStyle style,
+	std::string_view title, std::string_view content, std::string_view button1,
+	std::string_view button2)
+{
+	auto& shown = this->shown[player.getID()];
+	shown.style = style;
+	shown.title.assign(title);
+	shown.content.assign(content);
+	shown.button1.assign(button1);
+	shown.button2.assign(button2);
+	this->dialogsShown.increment();
 
 	IPlayerDialogData* dialogData = queryExtension<IPlayerDialogData>(player);
-	dialogData->show(player, MAGIC_DIALOG_ID, dialog->style, dialog->title,
-		dialog->content, dialog->button1, dialog->button2);
+	dialogData->show(player, MAGIC_DIALOG_ID, style, shown.title,
+		shown.content, shown.button1, shown.button2);
 }
 
 }
\ No newline at end of file
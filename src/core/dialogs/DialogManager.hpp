@@ -1,13 +1,23 @@
 #pragma once
 
 #include "DialogResult.hpp"
+#include "DialogTemplate.hpp"
 #include "Dialogs.hpp"
 #include "IDialog.hpp"
+#include "../RateLimiter.hpp"
+#include "../utils/InplaceFunction.hpp"
+#include "../utils/Metrics.hpp"
 #include <Server/Components/Dialogs/dialogs.hpp>
+#include <values.hpp>
 
+#include <array>
 #include <functional>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
 
 #define MAGIC_DIALOG_ID 1337
 
@@ -25,10 +35,12 @@ namespace Core
 {
 class DialogManager : public PlayerDialogEventHandler
 {
-	typedef std::function<void(DialogResult)> Callback;
+	typedef Utils::InplaceFunction<void(DialogResult)> Callback;
+	typedef std::function<std::shared_ptr<IDialog>()> TemplateBuilder;
 
 public:
-	DialogManager(IComponentList* components);
+	DialogManager(IComponentList* components,
+		std::shared_ptr<RateLimiter> rateLimiter);
 	~DialogManager();
 
 	void onDialogResponse(IPlayer& player, int dialogId,
@@ -45,13 +57,39 @@ public:
 	void showDialog(IPlayer& player,
 		std::shared_ptr<TabListHeadersDialog> dialog,
 		DialogManager::Callback callback);
+	// Shows a dialog cached per (kind, player language). The builder only runs
+	// on a cache miss and marks dynamic cells with DIALOG_SLOT, values are
+	// spliced into those cells in order.
+	void showDialog(IPlayer& player, DialogKind kind,
+		const TemplateBuilder& builder,
+		std::initializer_list<std::string_view> values,
+		DialogManager::Callback callback);
 	void hideDialog(IPlayer& player);
 
 private:
-	// player id -> dialog callback
-	std::map<unsigned int, DialogManager::Callback> dialogs;
+	struct ShownDialog
+	{
+		DialogStyle style;
+		std::string title;
+		std::string content;
+		std::string button1;
+		std::string button2;
+	};
+
+	// dialog callback of each player slot
+	std::array<DialogManager::Callback, PLAYER_POOL_SIZE> dialogs;
+	// the dialog each slot was shown last, the strings keep their capacity
+	// so remembering it doesn't allocate once they've grown
+	std::array<ShownDialog, PLAYER_POOL_SIZE> shown;
 	IDialogsComponent* dialogsComponent = nullptr;
+	std::shared_ptr<RateLimiter> rateLimiter;
+	std::map<std::pair<DialogKind, std::string>, DialogTemplate> templates;
+	std::string renderBuffer;
+	Utils::Counter& dialogsShown;
 	void showDialog(IPlayer& player, std::shared_ptr<IDialog> dialog,
 		DialogManager::Callback callback);
+	void show(IPlayer& player, DialogStyle style, std::string_view title,
+		std::string_view content, std::string_view button1,
+		std::string_view button2);
 };
 }
\ No newline at end of file
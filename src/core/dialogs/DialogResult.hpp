@@ -2,11 +2,16 @@
 
 #include <Server/Components/Dialogs/dialogs.hpp>
 
+#include <string_view>
+
 namespace Core
 {
+/// Only valid while the dialog callback runs, inputText points into the
+/// SDK's buffer
 struct DialogResult
 {
-	DialogResult(DialogResponse response, int listItem, std::string inputText)
+	DialogResult(
+		DialogResponse response, int listItem, std::string_view inputText)
 		: mResponse(response)
 		, mListItem(listItem)
 		, mInputText(inputText)
@@ -15,11 +20,11 @@ struct DialogResult
 
 	const DialogResponse& response() { return mResponse; };
 	const int& listItem() { return mListItem; };
-	const std::string& inputText() { return mInputText; };
+	std::string_view inputText() { return mInputText; };
 
 private:
 	DialogResponse mResponse;
 	int mListItem;
-	std::string mInputText;
+	std::string_view mInputText;
 };
 }
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include "DialogTemplate.hpp"
+
+#include <cstring>
+
+namespace Core
+{
+DialogTemplate::DialogTemplate(const IDialog& dialog)
+	: style(dialog.style)
+	, title(dialog.title)
+	, button1(dialog.button1)
+	, button2(dialog.button2)
+{
+	this->body.reserve(dialog.content.size());
+	for (char ch : dialog.content)
+	{
+		if (ch == DIALOG_SLOT[0])
+			this->slots.push_back(this->body.size());
+		else
+			this->body += ch;
+	}
+}
+
+void DialogTemplate::render(
+	std::string& out, std::initializer_list<std::string_view> values) const
+{
+	std::size_t length = this->body.size();
+	for (auto value : values)
+		length += value.size();
+
+	out.clear();
+	out.reserve(length);
+
+	std::size_t position = 0;
+	auto value = values.begin();
+	for (auto slot : this->slots)
+	{
+		out.append(this->body, position, slot - position);
+		if (value != values.end())
+			out.append(*value++);
+		position = slot;
+	}
+	out.append(this->body, position);
+}
+
+std::string formatToSlots(std::string_view format)
+{
+	static const char* CONVERSIONS = "diouxXeEfFgGaAcsp";
+
+	std::string result;
+	result.reserve(format.size());
+	for (std::size_t i = 0; i < format.size(); i++)
+	{
+		if (format[i] != '%')
+		{
+			result += format[i];
+			continue;
+		}
+		if (i + 1 < format.size() && format[i + 1] == '%')
+		{
+			result += '%';
+			i++;
+			continue;
+		}
+		// skip flags, width, precision and length up to the conversion
+		while (i + 1 < format.size()
+			&& !std::strchr(CONVERSIONS, format[i + 1]))
+			i++;
+		i++;
+		result += DIALOG_SLOT;
+	}
+	return result;
+}
+}
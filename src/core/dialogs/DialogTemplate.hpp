@@ -0,0 +1,46 @@
+#pragma once
+
+#include "IDialog.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core
+{
+// Marks a dynamic cell in a dialog that is about to be cached
+inline const std::string DIALOG_SLOT = "\x01";
+
+enum class DialogKind
+{
+	VehicleSpawning,
+	ModeSelection,
+	DeathmatchStats,
+	X1Stats,
+	DuelStats
+};
+
+/// Dialog rendered once per language. Dynamic cells are cut out of the body
+/// and only their offsets are kept, so showing it again is a matter of
+/// splicing the fresh values in.
+struct DialogTemplate
+{
+	DialogTemplate(const IDialog& dialog);
+
+	DialogStyle style;
+	std::string title;
+	std::string body;
+	std::string button1;
+	std::string button2;
+	/// Offsets into body where the dynamic values go, ascending
+	std::vector<std::size_t> slots;
+
+	void render(std::string& out,
+		std::initializer_list<std::string_view> values) const;
+};
+
+/// Replaces every printf conversion of the format with DIALOG_SLOT
+std::string formatToSlots(std::string_view format);
+}
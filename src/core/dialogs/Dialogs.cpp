@@ -6,6 +6,37 @@
 
 namespace Core
 {
+template <typename Row>
+static void appendTabListRow(std::string& body, const Row& row)
+{
+	for (std::size_t i = 0; i < row.size(); i++)
+	{
+		if (i > 0)
+			body += '\t';
+		body += Utils::Strings::trim_view(row[i]);
+	}
+}
+
+template <typename Items>
+static void appendListItems(std::string& body, const Items& items)
+{
+	for (const auto& item : items)
+	{
+		body += Utils::Strings::trim_view(item);
+		body += '\n';
+	}
+}
+
+template <typename Rows>
+static void appendTabListRows(std::string& body, const Rows& rows)
+{
+	for (const auto& row : rows)
+	{
+		body += '\n';
+		appendTabListRow(body, row);
+	}
+}
+
 InputDialog::InputDialog(const std::string& title, const std::string& content,
 	bool isPassword, const std::string& button1, const std::string& button2)
 	: super(DialogStyle_INPUT)
@@ -20,18 +51,22 @@ InputDialog::InputDialog(const std::string& title, const std::string& content,
 }
 
 ListDialog::ListDialog(const std::string& title,
-	const std::vector<std::string> items, const std::string& button1,
+	const std::vector<std::string>& items, const std::string& button1,
 	const std::string& button2)
 	: super(DialogStyle_LIST)
-	, items(items)
 {
-	std::string body;
-	for (const auto& item : items)
-	{
-		body += Utils::Strings::trim_copy(item) + "\n";
-	}
+	appendListItems(this->content, items);
+	this->title = title;
+	this->button1 = button1;
+	this->button2 = button2;
+}
+
+ListDialog::ListDialog(const std::string& title, const TransientRow& items,
+	const std::string& button1, const std::string& button2)
+	: super(DialogStyle_LIST)
+{
+	appendListItems(this->content, items);
 	this->title = title;
-	this->content = body;
 	this->button1 = button1;
 	this->button2 = button2;
 }
@@ -48,56 +83,45 @@ MessageDialog::MessageDialog(const std::string& title,
 }
 
 TabListHeadersDialog::TabListHeadersDialog(const std::string& title,
-	const std::vector<std::string> columns,
-	std::vector<std::vector<std::string>> items, const std::string& button1,
-	const std::string& button2)
+	const std::vector<std::string>& columns,
+	const std::vector<std::vector<std::string>>& items,
+	const std::string& button1, const std::string& button2)
 	: super(DialogStyle_TABLIST_HEADERS)
-	, items(items)
 {
-	std::string body;
-	for (const auto& column : columns)
-	{
-		body += Utils::Strings::trim_copy(column) + "\t";
-	}
-	body.erase(body.length() - 1);
-	body += "\n";
-	for (const auto& row : items)
-	{
-		for (const auto& value : row)
-		{
-			body += Utils::Strings::trim_copy(value) + "\t";
-		}
-		body.erase(body.length() - 1);
-		body += "\n";
-	}
-	body.erase(body.length() - 1);
+	appendTabListRow(this->content, columns);
+	appendTabListRows(this->content, items);
+
+	this->title = title;
+	this->button1 = button1;
+	this->button2 = button2;
+}
+
+TabListHeadersDialog::TabListHeadersDialog(const std::string& title,
+	const std::vector<std::string>& columns, const TransientRows& items,
+	const std::string& button1, const std::string& button2)
+	: super(DialogStyle_TABLIST_HEADERS)
+{
+	appendTabListRow(this->content, columns);
+	appendTabListRows(this->content, items);
 
 	this->title = title;
-	this->content = body;
 	this->button1 = button1;
 	this->button2 = button2;
 }
 
 TabListDialog::TabListDialog(const std::string& title,
-	std::vector<std::vector<std::string>> items, const std::string& button1,
-	const std::string& button2)
+	const std::vector<std::vector<std::string>>& items,
+	const std::string& button1, const std::string& button2)
 	: super(DialogStyle_TABLIST)
-	, items(items)
 {
-	std::string body;
-	for (const auto& row : items)
+	for (std::size_t i = 0; i < items.size(); i++)
 	{
-		for (const auto& value : row)
-		{
-			body += Utils::Strings::trim_copy(value) + "\t";
-		}
-		body.erase(body.length() - 1);
-		body += "\n";
+		if (i > 0)
+			this->content += '\n';
+		appendTabListRow(this->content, items[i]);
 	}
-	body.erase(body.length() - 1);
 
 	this->title = title;
-	this->content = body;
 	this->button1 = button1;
 	this->button2 = button2;
 }
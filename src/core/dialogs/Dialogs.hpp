@@ -1,10 +1,17 @@
 #pragma once
 
 #include "IDialog.hpp"
+#include "../utils/TickArena.hpp"
+#include <string>
 #include <vector>
 
 namespace Core
 {
+/// Rows of dialogs that are rebuilt every time they are shown, allocated
+/// from the tick arena. The dialog copies them into its content right away.
+typedef Utils::TransientVector<Utils::TransientString> TransientRow;
+typedef Utils::TransientVector<TransientRow> TransientRows;
+
 class InputDialog : public IDialog
 {
 public:
@@ -17,28 +24,30 @@ public:
 class ListDialog : public IDialog
 {
 public:
-	ListDialog(const std::string& title, const std::vector<std::string> items,
+	ListDialog(const std::string& title, const std::vector<std::string>& items,
+		const std::string& button1, const std::string& button2);
+	ListDialog(const std::string& title, const TransientRow& items,
 		const std::string& button1, const std::string& button2);
-	std::vector<std::string> items;
 };
 
 class TabListHeadersDialog : public IDialog
 {
 public:
 	TabListHeadersDialog(const std::string& title,
-		const std::vector<std::string> columns,
-		std::vector<std::vector<std::string>> items, const std::string& button1,
-		const std::string& button2);
-	std::vector<std::vector<std::string>> items;
+		const std::vector<std::string>& columns,
+		const std::vector<std::vector<std::string>>& items,
+		const std::string& button1, const std::string& button2);
+	TabListHeadersDialog(const std::string& title,
+		const std::vector<std::string>& columns, const TransientRows& items,
+		const std::string& button1, const std::string& button2);
 };
 
 class TabListDialog : public IDialog
 {
 public:
 	TabListDialog(const std::string& title,
-		std::vector<std::vector<std::string>> items, const std::string& button1,
-		const std::string& button2);
-	std::vector<std::vector<std::string>> items;
+		const std::vector<std::vector<std::string>>& items,
+		const std::string& button1, const std::string& button2);
 };
 
 class MessageDialog : public IDialog
@@ -55,11 +55,27 @@ void OasisPlayerExt::reset()
 	_textDrawManager.reset();
 }
 
+const std::string& OasisPlayerExt::translate(const std::string& message)
+{
+	if (!this->_playerData)
+		return message;
+	return Localization::translate(message, this->_playerData->language);
+}
+
+void OasisPlayerExt::sendMessage(const Utils::MessageBuilder& builder)
+{
+	auto message = builder.view();
+	_player.sendClientMessage(
+		Colour::White(), StringView(message.data(), message.size()));
+}
+
 void OasisPlayerExt::sendInfoMessage(const std::string& message)
 {
-	_player.sendClientMessage(Colour::White(),
-		fmt::sprintf(
-			"%s %s", _("#LIME#>>#WHITE#", _player), _(message, _player)));
+	Utils::MessageBuilder builder;
+	builder.append(this->translate(INFO_MESSAGE_PREFIX))
+		.append(' ')
+		.append(this->translate(message));
+	this->sendMessage(builder);
 }
 
 void OasisPlayerExt::showNotification(const std::string& notification,
@@ -3,6 +3,8 @@
 #include "PlayerModel.hpp"
 #include "TextDrawManager.hpp"
 #include "../textdraws/Notification.hpp"
+#include "../utils/Localization.hpp"
+#include "../utils/MessageBuilder.hpp"
 #include "../../modes/Modes.hpp"
 
 #include <types.hpp>
@@ -23,6 +25,9 @@
 
 namespace Core::Player
 {
+inline const std::string INFO_MESSAGE_PREFIX = "#LIME#>>#WHITE#";
+inline const std::string ERROR_MESSAGE_PREFIX = "#RED#[ERROR]#WHITE#";
+
 class OasisPlayerExt : public IExtension
 {
 private:
@@ -31,6 +36,9 @@ private:
 	IPlayer& _player;
 	ITimersComponent* _timerManager;
 
+	const std::string& translate(const std::string& message);
+	void sendMessage(const Utils::MessageBuilder& builder);
+
 public:
 	PROVIDE_EXT_UID(OASIS_PLAYER_EXT_UID)
 
@@ -47,17 +55,21 @@ public:
 	template <typename... T>
 	inline void sendInfoMessage(const std::string& message, T&&... args)
 	{
-		_player.sendClientMessage(Colour::White(),
-			fmt::sprintf("%s %s", _("#LIME#>>#WHITE#", _player),
-				fmt::sprintf(_(message, _player), std::forward<T>(args)...)));
+		Utils::MessageBuilder builder;
+		builder.append(this->translate(INFO_MESSAGE_PREFIX))
+			.append(' ')
+			.appendPrintf(this->translate(message), args...);
+		this->sendMessage(builder);
 	}
 
 	template <typename... T>
 	inline void sendErrorMessage(const std::string& message, T&&... args)
 	{
-		_player.sendClientMessage(Colour::White(),
-			fmt::format("{} {}", _("#RED#[ERROR]#WHITE#", _player),
-				fmt::sprintf(_(message, _player), std::forward<T>(args)...)));
+		Utils::MessageBuilder builder;
+		builder.append(this->translate(ERROR_MESSAGE_PREFIX))
+			.append(' ')
+			.appendPrintf(this->translate(message), args...);
+		this->sendMessage(builder);
 	}
 
 	void showNotification(const std::string& notification,
@@ -66,28 +78,28 @@ public:
 	template <typename... T>
 	inline void sendTranslatedMessage(const std::string& message, T&&... args)
 	{
-		_player.sendClientMessage(Colour::White(),
-			fmt::sprintf(_(message, _player), std::forward<T>(args)...));
+		Utils::MessageBuilder builder;
+		builder.appendPrintf(this->translate(message), args...);
+		this->sendMessage(builder);
 	}
 
 	template <typename... T>
 	inline void sendModeMessage(const std::string& message, T&&... args)
 	{
-		auto mode = this->getMode();
-		this->_player.sendClientMessage(Colour::White(),
-			fmt::sprintf("%s {%s}%s{FFFFFF}: %s", _("#LIME#>>#WHITE#", _player),
-				Modes::getModeColor(mode), Modes::getModeShortName(mode),
-				fmt::sprintf(_(message, _player), std::forward<T>(args)...)));
+		this->sendModeMessage(this->getMode(), message, args...);
 	}
 
 	template <typename... T>
 	inline void sendModeMessage(
 		Modes::Mode mode, const std::string& message, T&&... args)
 	{
-		this->_player.sendClientMessage(Colour::White(),
-			fmt::sprintf("%s {%s}%s{FFFFFF}: %s", _("#LIME#>>#WHITE#", _player),
-				Modes::getModeColor(mode), Modes::getModeShortName(mode),
-				fmt::sprintf(_(message, _player), std::forward<T>(args)...)));
+		Utils::MessageBuilder builder;
+		builder.append(this->translate(INFO_MESSAGE_PREFIX))
+			.append(' ')
+			.append(Modes::getModeTag(mode))
+			.append(": ")
+			.appendPrintf(this->translate(message), args...);
+		this->sendMessage(builder);
 	}
 
 	const std::string getIP();
@@ -102,9 +114,11 @@ public:
 	inline void sendGameText(
 		const std::string& message, Milliseconds time, int style, T&&... args)
 	{
+		Utils::MessageBuilder builder;
+		builder.appendPrintf(this->translate(message), args...);
+		auto text = builder.view();
 		this->_player.sendGameText(
-			fmt::sprintf(_(message, this->_player), std::forward<T>(args)...),
-			time, style);
+			StringView(text.data(), text.size()), time, style);
 	}
 
 	void freeExtension() override;
@@ -0,0 +1,63 @@
+#include "PlayerHandle.hpp"
+
+#include <values.hpp>
+
+#include <array>
+
+namespace Core::Player
+{
+struct PlayerSlot
+{
+	IPlayer* player = nullptr;
+	std::uint32_t generation = 0;
+};
+
+// only touched from the main thread
+static std::array<PlayerSlot, PLAYER_POOL_SIZE> slots;
+
+PlayerHandle PlayerHandle::of(const IPlayer& player)
+{
+	int slot = player.getID();
+	return PlayerHandle { .slot = slot, .generation = slots[slot].generation };
+}
+
+IPlayer* PlayerHandle::get() const
+{
+	if (this->slot < 0 || this->slot >= PLAYER_POOL_SIZE)
+		return nullptr;
+	const auto& slot = slots[this->slot];
+	return slot.generation == this->generation ? slot.player : nullptr;
+}
+
+void PlayerSlotTracker::ConnectHandler::onPlayerConnect(IPlayer& player)
+{
+	auto& slot = slots[player.getID()];
+	slot.player = &player;
+	slot.generation++;
+}
+
+void PlayerSlotTracker::DisconnectHandler::onPlayerDisconnect(
+	IPlayer& player, PeerDisconnectReason reason)
+{
+	auto& slot = slots[player.getID()];
+	slot.player = nullptr;
+	slot.generation++;
+}
+
+PlayerSlotTracker::PlayerSlotTracker(IPlayerPool* playerPool)
+	: playerPool(playerPool)
+{
+	playerPool->getPlayerConnectDispatcher().addEventHandler(
+		&this->connectHandler, EventPriority_Highest);
+	playerPool->getPlayerConnectDispatcher().addEventHandler(
+		&this->disconnectHandler, EventPriority_Lowest);
+}
+
+PlayerSlotTracker::~PlayerSlotTracker()
+{
+	playerPool->getPlayerConnectDispatcher().removeEventHandler(
+		&this->connectHandler);
+	playerPool->getPlayerConnectDispatcher().removeEventHandler(
+		&this->disconnectHandler);
+}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <player.hpp>
+
+#include <cstdint>
+
+namespace Core::Player
+{
+/// Refers to a player by slot and by which of the slot's connections it was.
+/// Unlike an IPlayer* it can be kept around after the player is gone: get()
+/// then returns nullptr, even when somebody else has taken the slot since.
+struct PlayerHandle
+{
+	int slot = -1;
+	std::uint32_t generation = 0;
+
+	static PlayerHandle of(const IPlayer& player);
+
+	/// The player, or nullptr once they have disconnected
+	IPlayer* get() const;
+	bool valid() const { return this->get() != nullptr; }
+
+	bool operator==(const PlayerHandle& other) const = default;
+};
+
+/// Keeps the slot generations handles are checked against. A slot is taken
+/// before any other connect handler runs and freed after every disconnect
+/// handler, so handles stay valid for the whole disconnect.
+class PlayerSlotTracker
+{
+	struct ConnectHandler : public PlayerConnectEventHandler
+	{
+		void onPlayerConnect(IPlayer& player) override;
+	};
+
+	struct DisconnectHandler : public PlayerConnectEventHandler
+	{
+		void onPlayerDisconnect(
+			IPlayer& player, PeerDisconnectReason reason) override;
+	};
+
+	IPlayerPool* const playerPool;
+	ConnectHandler connectHandler;
+	DisconnectHandler disconnectHandler;
+
+public:
+	PlayerSlotTracker(IPlayerPool* playerPool);
+	~PlayerSlotTracker();
+};
+}
@@ -53,6 +53,24 @@ struct PlayerModel
 
 	PlayerModel() = default;
 
+	/// Copies what gets saved to the database, so another thread can save
+	/// it while the main thread keeps changing this one
+	std::shared_ptr<PlayerModel> snapshot() const
+	{
+		auto copy = std::make_shared<PlayerModel>();
+		copy->userId = userId;
+		copy->name = name;
+		copy->language = language;
+		copy->lastIP = lastIP;
+		copy->lastSkinId = lastSkinId;
+		copy->lastLoginAt = lastLoginAt;
+		*copy->settings = *settings;
+		*copy->dmStats = *dmStats;
+		*copy->x1Stats = *x1Stats;
+		*copy->duelStats = *duelStats;
+		return copy;
+	}
+
 	void updateFromRow(const pqxx::row& row)
 	{
 		userId = row["id"].as<unsigned long>();
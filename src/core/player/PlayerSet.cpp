@@ -0,0 +1,63 @@
+#include "PlayerSet.hpp"
+
+namespace Core::Player
+{
+bool PlayerSet::insert(const IPlayer& player)
+{
+	int slot = player.getID();
+	auto handle = PlayerHandle::of(player);
+	if (this->slots.test(slot))
+	{
+		auto& member = this->members[this->positions[slot]];
+		if (member == handle)
+			return false;
+		// left over from whoever had the slot before
+		member = handle;
+		return true;
+	}
+	this->slots.set(slot);
+	this->positions[slot] = this->members.size();
+	this->members.push_back(handle);
+	return true;
+}
+
+bool PlayerSet::erase(const IPlayer& player)
+{
+	int slot = player.getID();
+	if (!this->slots.test(slot))
+		return false;
+	this->slots.reset(slot);
+	auto position = this->positions[slot];
+	bool wasMember = this->members[position] == PlayerHandle::of(player);
+	const auto last = this->members.back();
+	this->positions[last.slot] = position;
+	this->members[position] = last;
+	this->members.pop_back();
+	return wasMember;
+}
+
+void PlayerSet::clear()
+{
+	this->slots.reset();
+	this->members.clear();
+}
+
+PlayerSet PlayerSet::intersect(const PlayerSet& other) const
+{
+	PlayerSet result;
+	const auto common = this->slots & other.slots;
+	if (common.none())
+		return result;
+	for (const auto& member : this->members)
+	{
+		if (common.test(member.slot)
+			&& other.members[other.positions[member.slot]] == member)
+		{
+			result.slots.set(member.slot);
+			result.positions[member.slot] = result.members.size();
+			result.members.push_back(member);
+		}
+	}
+	return result;
+}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "PlayerHandle.hpp"
+
+#include <player.hpp>
+#include <values.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace Core::Player
+{
+/// Set of players keyed by slot. Membership is a bit per slot, the members
+/// themselves are kept packed in a vector for iteration and removing one
+/// swaps the last member into its place, so members keep the order they
+/// joined in until somebody leaves. Iterating skips members whose player has
+/// disconnected without being erased.
+class PlayerSet
+{
+public:
+	typedef std::bitset<PLAYER_POOL_SIZE> Bits;
+
+private:
+	Bits slots;
+	std::vector<PlayerHandle> members;
+	/// where each slot's member is in `members`
+	std::array<std::uint16_t, PLAYER_POOL_SIZE> positions {};
+
+public:
+	class const_iterator
+	{
+		const PlayerHandle* current = nullptr;
+		const PlayerHandle* end = nullptr;
+
+		void skipStale()
+		{
+			while (this->current != this->end && !this->current->valid())
+				++this->current;
+		}
+
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef IPlayer* value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef IPlayer* const* pointer;
+		typedef IPlayer* reference;
+
+		const_iterator() = default;
+		const_iterator(const PlayerHandle* current, const PlayerHandle* end)
+			: current(current)
+			, end(end)
+		{
+			this->skipStale();
+		}
+
+		IPlayer* operator*() const { return this->current->get(); }
+
+		const_iterator& operator++()
+		{
+			++this->current;
+			this->skipStale();
+			return *this;
+		}
+
+		const_iterator operator++(int)
+		{
+			auto previous = *this;
+			++*this;
+			return previous;
+		}
+
+		bool operator==(const const_iterator& other) const
+		{
+			return this->current == other.current;
+		}
+	};
+
+	/// Returns false if the player was already in the set
+	bool insert(const IPlayer& player);
+	/// Returns false if the player wasn't in the set
+	bool erase(const IPlayer& player);
+	void clear();
+
+	bool contains(const IPlayer& player) const
+	{
+		int slot = player.getID();
+		// the generation check only runs for set bits, so a miss is a single
+		// bit test
+		return this->slots.test(slot)
+			&& this->members[this->positions[slot]]
+			== PlayerHandle::of(player);
+	}
+
+	/// Members of this set that are also in the other one, in this set's
+	/// order
+	PlayerSet intersect(const PlayerSet& other) const;
+
+	/// One bit per slot, for combining sets with &, | and ~ without
+	/// touching the members
+	const Bits& bits() const { return this->slots; }
+
+	std::size_t size() const { return this->members.size(); }
+	bool empty() const { return this->members.empty(); }
+
+	/// The member at the given position, nullptr if there is no such
+	/// position or the member has disconnected
+	IPlayer* at(std::size_t index) const
+	{
+		if (index >= this->members.size())
+			return nullptr;
+		return this->members[index].get();
+	}
+
+	const_iterator begin() const
+	{
+		auto data = this->members.data();
+		return const_iterator(data, data + this->members.size());
+	}
+
+	const_iterator end() const
+	{
+		auto end = this->members.data() + this->members.size();
+		return const_iterator(end, end);
+	}
+};
+}
@@ -0,0 +1,173 @@
+#include "AllocationTracker.hpp"
+
+#ifdef OASIS_TRACK_ALLOCATIONS
+#include "Logging.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#if defined(__SANITIZE_ADDRESS__)
+#error "OASIS_TRACK_ALLOCATIONS replaces operator new and can't be combined \
+with AddressSanitizer"
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#error "OASIS_TRACK_ALLOCATIONS replaces operator new and can't be combined \
+with AddressSanitizer"
+#endif
+#endif
+
+namespace Core::Utils
+{
+static thread_local AllocationCounters gThreadAllocations;
+
+AllocationCounters threadAllocations()
+{
+	return gThreadAllocations;
+}
+
+AllocationScope::AllocationScope(const char* name)
+	: name(name)
+	, startedWith(gThreadAllocations)
+{
+}
+
+AllocationScope::~AllocationScope()
+{
+	auto allocations
+		= gThreadAllocations.allocations - this->startedWith.allocations;
+	auto bytes = gThreadAllocations.bytes - this->startedWith.bytes;
+	if (allocations > 0)
+		OASIS_LOG_SAMPLED(spdlog::level::debug, ALLOCATION_LOG_SAMPLE_RATE,
+			"{}: {} allocations, {} bytes", this->name, allocations, bytes);
+}
+}
+
+static void* countedAllocation(std::size_t size, std::size_t alignment)
+{
+	Core::Utils::gThreadAllocations.allocations++;
+	Core::Utils::gThreadAllocations.bytes += size;
+	if (size == 0)
+		size = 1;
+	if (alignment <= alignof(std::max_align_t))
+		return std::malloc(size);
+	// aligned_alloc wants a size that is a multiple of the alignment
+	return std::aligned_alloc(
+		alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+static void* countedAllocationOrThrow(std::size_t size, std::size_t alignment)
+{
+	if (void* ptr = countedAllocation(size, alignment))
+		return ptr;
+	throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size)
+{
+	return countedAllocationOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+	return countedAllocationOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	return countedAllocationOrThrow(size, std::size_t(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+	return countedAllocationOrThrow(size, std::size_t(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return countedAllocation(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return countedAllocation(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment,
+	const std::nothrow_t&) noexcept
+{
+	return countedAllocation(size, std::size_t(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment,
+	const std::nothrow_t&) noexcept
+{
+	return countedAllocation(size, std::size_t(alignment));
+}
+
+// malloc and aligned_alloc memory are both released with free, so every
+// delete overload ends up here
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(
+	void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](
+	void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+#endif
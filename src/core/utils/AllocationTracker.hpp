@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+/// Heap allocation accounting, compiled in with the OASIS_TRACK_ALLOCATIONS
+/// CMake option. It replaces the global operator new of the gamemode, so it
+/// is meant for debug builds only, and the build drops AddressSanitizer while
+/// it is on since ASan brings its own operator new.
+#ifdef OASIS_TRACK_ALLOCATIONS
+namespace Core::Utils
+{
+/// every handler call logs its allocations otherwise, which would flood the
+/// log ring and push out everything else
+inline const unsigned int ALLOCATION_LOG_SAMPLE_RATE = 64;
+
+struct AllocationCounters
+{
+	std::uint64_t allocations = 0;
+	std::uint64_t bytes = 0;
+};
+
+/// Allocations made by the calling thread so far
+AllocationCounters threadAllocations();
+
+/// Logs the allocations made on this thread while the scope was alive, for
+/// one in ALLOCATION_LOG_SAMPLE_RATE of the scopes that allocated
+class AllocationScope
+{
+	const char* name;
+	AllocationCounters startedWith;
+
+public:
+	AllocationScope(const char* name);
+	~AllocationScope();
+};
+}
+
+#define OASIS_ALLOCATION_SCOPE(name)                                           \
+	Core::Utils::AllocationScope allocationScope__(name)
+#else
+#define OASIS_ALLOCATION_SCOPE(name)
+#endif
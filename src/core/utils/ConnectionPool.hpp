@@ -1,11 +1,25 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <libpq-fe.h>
+#include <limits>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <mutex>
 #include <pqxx/pqxx>
 #include <queue>
+#include <spdlog/spdlog.h>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace cp
 {
@@ -22,6 +36,38 @@ struct connection_options
 	int connections_count = 8;
 };
 
+// counters since the pool was created, see connection_pool::stats()
+struct pool_stats
+{
+	std::uint64_t borrows = 0;
+	std::uint64_t statements = 0;
+	std::uint64_t round_trips = 0;
+	std::chrono::nanoseconds borrow_wait {};
+	// connections borrowed right now
+	unsigned int in_use = 0;
+	// connections opened and warmed up, out of `connections`
+	unsigned int ready = 0;
+	unsigned int failed = 0;
+	unsigned int connections = 0;
+};
+
+// throws std::invalid_argument if libpq can't parse the connection string,
+// so a typo shows up before anything waits for the connections
+inline void validate_connection_string(const std::string& connection_string)
+{
+	char* error = nullptr;
+	auto options = PQconninfoParse(connection_string.c_str(), &error);
+	if (options)
+	{
+		PQconninfoFree(options);
+		return;
+	}
+	std::string message = error ? error : "out of memory";
+	PQfreemem(error);
+	throw std::invalid_argument(
+		std::format("invalid connection string: {}", message));
+}
+
 struct connection_manager
 {
 	connection_manager(std::unique_ptr<pqxx::connection>& connection)
@@ -39,7 +85,14 @@ struct connection_manager
 		prepares.insert(name);
 	}
 
+	bool is_prepared(const std::string& name)
+	{
+		std::scoped_lock lock(prepares_mutex);
+		return prepares.contains(name);
+	}
+
 	friend struct basic_connection;
+	friend struct connection_pool;
 
 private:
 	std::unordered_set<std::string> prepares {};
@@ -60,19 +113,72 @@ struct connection_pool
 	}
 
 	connection_pool(const std::string& connection_string,
-		const unsigned int connections_count)
+		const unsigned int connections_count, bool connect_now = true)
+		: connection_string(connection_string)
+		, connections_count(connections_count)
+	{
+		if (connect_now)
+			connect();
+	}
+
+	~connection_pool() { join_connect_threads(); }
+
+	connection_pool(const connection_pool&) = delete;
+	connection_pool& operator=(const connection_pool&) = delete;
+
+	// statement prepared on every connection right after it's opened
+	void prepare_on_connect(
+		const std::string& name, const std::string& definition)
+	{
+		warmup_statements.emplace_back(name, definition);
+	}
+
+	// definition of a statement registered through prepare_on_connect(),
+	// nullptr if there's no such statement. The list is only written before
+	// connect(), so it's read without a lock
+	const std::string* registered_statement(std::string_view name) const
 	{
+		for (const auto& [statement, definition] : warmup_statements)
+		{
+			if (statement == name)
+				return &definition;
+		}
+		return nullptr;
+	}
+
+	// opens all connections concurrently and returns once min_ready of them
+	// are warmed up (all of them if zero), the rest join the pool in the
+	// background. Throws if fewer than min_ready connections could be opened
+	void connect(unsigned int min_ready = 0)
+	{
+		if (min_ready == 0 || min_ready > connections_count)
+			min_ready = connections_count;
+
 		for (int i = 0; i < connections_count; ++i)
 		{
-			auto connection
-				= std::make_unique<pqxx::connection>(connection_string);
-			auto manager = std::make_unique<connection_manager>(connection);
-			connections.push(std::move(manager));
+			connect_threads.emplace_back(&connection_pool::open_connection,
+				this);
 		}
+
+		std::unique_lock lock(connections_mutex);
+		connections_cond.wait(lock,
+			[this, min_ready]()
+			{
+				return ready_count >= min_ready
+					|| ready_count + failed_count == connections_count;
+			});
+		if (ready_count >= min_ready)
+			return;
+
+		lock.unlock();
+		join_connect_threads();
+		std::rethrow_exception(connect_error);
 	}
+	unsigned int ready_connections() const { return ready_count; }
 
 	std::unique_ptr<connection_manager> borrow_connection()
 	{
+		auto wait_started_at = std::chrono::steady_clock::now();
 		std::unique_lock lock(connections_mutex);
 		connections_cond.wait(lock,
 			[this]()
@@ -83,6 +189,12 @@ struct connection_pool
 		// if we have something here, we can borrow it from the queue
 		auto manager = std::move(connections.front());
 		connections.pop();
+		lock.unlock();
+
+		auto waited = std::chrono::steady_clock::now() - wait_started_at;
+		borrows++;
+		in_use++;
+		borrow_wait_ns += std::chrono::nanoseconds(waited).count();
 		return manager;
 	}
 
@@ -93,15 +205,117 @@ struct connection_pool
 			std::scoped_lock lock(connections_mutex);
 			connections.push(std::move(manager));
 		}
+		in_use--;
 
 		// notify that we're done
 		connections_cond.notify_one();
 	}
 
+	// statements sent to the server in a number of round-trips
+	void record_statements(std::uint64_t count, std::uint64_t trips = 1)
+	{
+		statements += count;
+		round_trips += trips;
+	}
+
+	// the counters one by one without taking the pool's mutex, for metric
+	// callbacks that may run while the main thread borrows connections
+	std::uint64_t borrow_count() const { return borrows; }
+	std::uint64_t statement_count() const { return statements; }
+	std::uint64_t round_trip_count() const { return round_trips; }
+	std::chrono::nanoseconds borrow_wait() const
+	{
+		return std::chrono::nanoseconds(borrow_wait_ns);
+	}
+	unsigned int in_use_count() const { return in_use; }
+
+	// a consistent snapshot of the counters, it takes the pool's mutex so
+	// it's meant for the periodic report, not for anything on the hot path
+	pool_stats stats() const
+	{
+		std::scoped_lock lock(connections_mutex);
+		return pool_stats {
+			.borrows = borrows,
+			.statements = statements,
+			.round_trips = round_trips,
+			.borrow_wait = std::chrono::nanoseconds(borrow_wait_ns),
+			.in_use = in_use,
+			.ready = ready_count,
+			.failed = failed_count,
+			.connections = connections_count,
+		};
+	}
+
 private:
-	std::mutex connections_mutex {};
+	void join_connect_threads()
+	{
+		for (auto& thread : connect_threads)
+		{
+			if (thread.joinable())
+				thread.join();
+		}
+	}
+
+	void open_connection()
+	{
+		try
+		{
+			auto connection
+				= std::make_unique<pqxx::connection>(connection_string);
+			auto manager = std::make_unique<connection_manager>(connection);
+			for (const auto& [name, definition] : warmup_statements)
+				manager->prepare(name, definition);
+			{
+				pqxx::nontransaction warmup(*manager->connection);
+				warmup.exec("SELECT 1");
+			}
+
+			{
+				std::scoped_lock lock(connections_mutex);
+				connections.push(std::move(manager));
+				ready_count++;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			// connect() only reports the first error and not at all once it
+			// has returned, so every failure is logged here
+			spdlog::warn("Failed to open a database connection: {}", e.what());
+			fail_connection();
+		}
+		catch (...)
+		{
+			spdlog::warn("Failed to open a database connection");
+			fail_connection();
+		}
+		connections_cond.notify_all();
+	}
+
+	void fail_connection()
+	{
+		std::scoped_lock lock(connections_mutex);
+		if (!connect_error)
+			connect_error = std::current_exception();
+		failed_count++;
+	}
+
+	std::string connection_string {};
+	unsigned int connections_count = 0;
+	std::vector<std::pair<std::string, std::string>> warmup_statements {};
+	std::vector<std::thread> connect_threads {};
+	// only changed under connections_mutex, atomic so it can be read
+	// without it
+	std::atomic<unsigned int> ready_count = 0;
+	unsigned int failed_count = 0;
+	std::exception_ptr connect_error {};
+	mutable std::mutex connections_mutex {};
 	std::condition_variable connections_cond {};
 	std::queue<std::unique_ptr<connection_manager>> connections {};
+	std::atomic<std::uint64_t> borrows = 0;
+	std::atomic<std::uint64_t> statements = 0;
+	std::atomic<std::uint64_t> round_trips = 0;
+	std::atomic<std::int64_t> borrow_wait_ns = 0;
+	std::atomic<unsigned int> in_use = 0;
 };
 
 struct basic_connection final
@@ -115,6 +329,7 @@ struct basic_connection final
 	~basic_connection() { pool.return_connection(manager); }
 
 	pqxx::connection& get() const { return *manager->connection; }
+	connection_pool& get_pool() const { return pool; }
 
 	operator pqxx::connection&() { return get(); }
 	operator const pqxx::connection&() const { return get(); }
@@ -130,6 +345,21 @@ struct basic_connection final
 		manager->prepare(std::string(name), std::string(definition));
 	}
 
+	// makes sure a statement registered with the pool is prepared on this
+	// connection, e.g. if warming it up failed for that one statement.
+	// Throws if the statement was never registered
+	void prepare_registered(std::string_view name)
+	{
+		std::string key(name);
+		if (manager->is_prepared(key))
+			return;
+		auto definition = pool.registered_statement(name);
+		if (!definition)
+			throw std::runtime_error(std::format(
+				"statement {} is not registered with the pool", name));
+		manager->prepare(key, *definition);
+	}
+
 	basic_connection(const basic_connection&) = delete;
 	basic_connection& operator=(const basic_connection&) = delete;
 
@@ -238,12 +468,21 @@ struct basic_transaction
 	basic_transaction(const basic_transaction&) = delete;
 	basic_transaction& operator=(const basic_transaction&) = delete;
 
-	pqxx::result exec(std::string_view q) { return transaction.exec(q); }
+	pqxx::result exec(std::string_view q)
+	{
+		connection.get_pool().record_statements(1);
+		return transaction.exec(q);
+	}
 	void commit() { transaction.commit(); }
 	void abort() { transaction.abort(); }
 
 	pqxx::work& get() { return transaction; }
 	operator pqxx::work&() { return get(); }
+	connection_pool& pool() const { return connection.get_pool(); }
+	void prepare_registered(std::string_view name)
+	{
+		connection.prepare_registered(name);
+	}
 
 	friend struct query_manager;
 	friend struct connection_pool;
@@ -253,9 +492,101 @@ private:
 	pqxx::work transaction;
 };
 
+// EXECUTE text for a prepared statement, with the name and every parameter
+// quoted by the connection
+template <typename... Args>
+std::string execute_text(
+	const pqxx::connection& conn, std::string_view statement, Args&&... args)
+{
+	std::string text = "EXECUTE ";
+	text += conn.quote_name(statement);
+	if constexpr (sizeof...(Args) > 0)
+	{
+		std::string_view separator = "(";
+		((text += separator, text += conn.quote(std::forward<Args>(args)),
+			 separator = ", "),
+			...);
+		text += ')';
+	}
+	return text;
+}
+
+// Queues executions of prepared statements and sends them to the server in a
+// single round-trip on flush(). The statements have to be registered through
+// prepare_on_connect(), any that the connection hasn't prepared yet are
+// prepared when they're queued
+struct pipeline_batch
+{
+	using result_handler = std::function<void(const pqxx::result&)>;
+
+	pipeline_batch(basic_transaction& transaction)
+		: owner(transaction)
+		, transaction(transaction.get())
+		, pool(transaction.pool())
+		, pipeline(this->transaction)
+	{
+		// hold everything back until flush()
+		pipeline.retain(std::numeric_limits<int>::max());
+	}
+
+	pipeline_batch(const pipeline_batch&) = delete;
+	pipeline_batch& operator=(const pipeline_batch&) = delete;
+
+	template <typename... Args>
+	void exec_prepared(std::string_view statement, Args&&... args)
+	{
+		queue(statement, {}, std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	void exec_prepared_then(std::string_view statement,
+		result_handler handler, Args&&... args)
+	{
+		queue(statement, std::move(handler), std::forward<Args>(args)...);
+	}
+
+	// sends the queued statements and runs the result handlers in order
+	void flush()
+	{
+		pipeline.complete();
+		if (!queued.empty())
+			pool.record_statements(queued.size());
+		auto pending = std::move(queued);
+		queued.clear();
+		for (auto& [id, handler] : pending)
+		{
+			auto result = pipeline.retrieve(id);
+			if (handler)
+				handler(result);
+		}
+	}
+
+	std::size_t size() const { return queued.size(); }
+
+private:
+	template <typename... Args>
+	void queue(
+		std::string_view statement, result_handler handler, Args&&... args)
+	{
+		// nothing has been sent yet, the retained queries only go out on
+		// flush(), so the connection is free to prepare
+		owner.prepare_registered(statement);
+		queued.emplace_back(pipeline.insert(execute_text(transaction.conn(),
+								statement, std::forward<Args>(args)...)),
+			std::move(handler));
+	}
+
+	basic_transaction& owner;
+	pqxx::work& transaction;
+	connection_pool& pool;
+	pqxx::pipeline pipeline;
+	std::vector<std::pair<pqxx::pipeline::query_id, result_handler>> queued {};
+};
+
 template <typename... Args>
 pqxx::result query_manager::exec_prepared(Args&&... args)
 {
+	transaction_view.pool().record_statements(1);
 	return transaction_view.transaction.exec_prepared(
 		query_id, std::forward<Args>(args)...);
 }
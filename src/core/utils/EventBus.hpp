@@ -0,0 +1,140 @@
+#pragma once
+
+#include "Events.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Core::Utils
+{
+template <typename MemberFunction> struct EventHandlerTraits;
+
+template <typename Class, typename Event>
+struct EventHandlerTraits<void (Class::*)(const Event&)>
+{
+	using ClassType = Class;
+	using EventType = Event;
+};
+
+/// Event bus over a set of event types fixed at compile time. Every event
+/// type has its own contiguous list of handlers, and each handler is a plain
+/// function generated for the subscribed member function, so firing an event
+/// is a loop of direct calls with the event passed by reference. Handlers
+/// unsubscribed while an event is being fired are skipped from then on and
+/// only erased once the outermost fire returns, so the lists never shift
+/// under a running loop.
+template <typename... Events> class StaticEventBus
+{
+	template <typename Event> struct Handler
+	{
+		const void* owner;
+		void* instance;
+		void (*invoke)(void* instance, const Event& event);
+	};
+
+	std::tuple<std::vector<Handler<Events>>...> handlers;
+	/// nesting depth of fire(), handlers are only erased at zero
+	std::size_t firing = 0;
+	bool removalPending = false;
+
+	template <typename Event> std::vector<Handler<Event>>& handlersOf()
+	{
+		static_assert((std::is_same_v<Event, Events> || ...),
+			"The event isn't part of this event bus");
+		return std::get<std::vector<Handler<Event>>>(this->handlers);
+	}
+
+	template <typename Function> void forEachList(Function function)
+	{
+		std::apply(
+			[&function](auto&... handlers)
+			{
+				(function(handlers), ...);
+			},
+			this->handlers);
+	}
+
+public:
+	/// Subscribes the instance's member function to the event it accepts,
+	/// e.g. bus.subscribe<&ModeBase::onDuelWin>(this)
+	template <auto MemberFunction, typename Class>
+	void subscribe(Class* instance)
+	{
+		using Traits = EventHandlerTraits<decltype(MemberFunction)>;
+		using Event = typename Traits::EventType;
+		using HandlerClass = typename Traits::ClassType;
+		static_assert(std::is_base_of_v<HandlerClass, Class>);
+
+		// stored as the class that declares the handler, so virtual
+		// overrides are still picked up
+		HandlerClass* handlerInstance = instance;
+		this->handlersOf<Event>().push_back(Handler<Event> {
+			.owner = instance,
+			.instance = handlerInstance,
+			.invoke =
+				[](void* instance, const Event& event)
+			{
+				(static_cast<HandlerClass*>(instance)->*MemberFunction)(event);
+			},
+		});
+	}
+
+	/// Removes every handler subscribed through the same instance pointer
+	template <typename Class> void unsubscribe(Class* instance)
+	{
+		const void* owner = instance;
+		if (this->firing > 0)
+		{
+			// a fire loop may be walking these lists, leave the entries in
+			// place and only stop them from being called
+			this->forEachList(
+				[owner](auto& handlers)
+				{
+					for (auto& handler : handlers)
+						if (handler.owner == owner)
+							handler.instance = nullptr;
+				});
+			this->removalPending = true;
+			return;
+		}
+		this->forEachList(
+			[owner](auto& handlers)
+			{
+				std::erase_if(handlers,
+					[owner](const auto& handler)
+					{
+						return handler.owner == owner;
+					});
+			});
+	}
+
+	template <typename Event> void fire(const Event& event)
+	{
+		// by index, a handler may subscribe more handlers while it runs
+		auto& handlers = this->handlersOf<Event>();
+		this->firing++;
+		for (std::size_t i = 0; i < handlers.size(); i++)
+			if (handlers[i].instance)
+				handlers[i].invoke(handlers[i].instance, event);
+		if (--this->firing > 0 || !this->removalPending)
+			return;
+		this->removalPending = false;
+		this->forEachList(
+			[](auto& handlers)
+			{
+				std::erase_if(handlers,
+					[](const auto& handler)
+					{
+						return handler.instance == nullptr;
+					});
+			});
+	}
+};
+
+using EventBus = StaticEventBus<Events::PlayerOnFireEvent,
+	Events::PlayerOnFireBeenKilled, Events::RoundEndEvent,
+	Events::PlayerJoinedMode, Events::X1ArenaWin, Events::DuelWin>;
+}
@@ -1,12 +1,11 @@
 #pragma once
 
 #include "../../modes/Modes.hpp"
+#include "../player/PlayerSet.hpp"
 
 #include <chrono>
 #include <player.hpp>
 
-#include <unordered_set>
-
 namespace Core::Utils::Events
 {
 struct PlayerOnFireEvent
@@ -26,7 +25,7 @@ struct PlayerOnFireBeenKilled
 struct RoundEndEvent
 {
 	Modes::Mode mode;
-	std::unordered_set<IPlayer*> players;
+	const Player::PlayerSet& players;
 };
 
 struct PlayerJoinedMode
@@ -1,5 +1,8 @@
 #include "IDPool.hpp"
+
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 
 namespace Core::Utils
 {
@@ -7,9 +10,11 @@ unsigned int IDPool::allocateId()
 {
 	if (!this->freeIds.empty())
 	{
-		auto firstUnusedId = this->freeIds.begin();
-		auto id = *firstUnusedId;
-		this->freeIds.erase(firstUnusedId);
+		std::pop_heap(
+			this->freeIds.begin(), this->freeIds.end(), std::greater<>());
+		auto id = this->freeIds.back();
+		this->freeIds.pop_back();
+		this->isFree[id] = false;
 		return id;
 	}
 	return this->maxId++;
@@ -17,7 +22,16 @@ unsigned int IDPool::allocateId()
 
 void IDPool::freeId(unsigned int id)
 {
-	if (id < this->maxId)
-		this->freeIds.insert(id);
+	if (id >= this->maxId)
+		return;
+	if (this->isFree.size() <= id)
+		this->isFree.resize(this->maxId);
+	if (this->isFree[id])
+		return;
+
+	this->isFree[id] = true;
+	this->freeIds.push_back(id);
+	std::push_heap(
+		this->freeIds.begin(), this->freeIds.end(), std::greater<>());
 }
 }
\ No newline at end of file
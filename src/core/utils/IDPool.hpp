@@ -1,14 +1,18 @@
 #pragma once
 
 #include <atomic>
-#include <set>
+#include <vector>
 
 namespace Core::Utils
 {
+/// Hands out the lowest free id first. Freed ids are kept in a min-heap
+/// over a flat vector, so allocating and freeing don't touch the allocator
+/// once the pool has reached its working size.
 class IDPool
 {
 	std::atomic<unsigned int> maxId = 0;
-	std::set<unsigned int> freeIds;
+	std::vector<unsigned int> freeIds;
+	std::vector<bool> isFree;
 
 public:
 	unsigned int allocateId();
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Core::Utils
+{
+template <typename Signature, std::size_t Capacity = 64> class InplaceFunction;
+
+/// std::function replacement that keeps callables of up to Capacity bytes
+/// inside the object itself. Bigger ones still work, but end up on the heap,
+/// so captures should be kept small on hot paths.
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+	struct Operations
+	{
+		R (*invoke)(void* callable, Args&&... args);
+		void (*copy)(void* to, const void* from);
+		void (*move)(void* to, void* from);
+		void (*destroy)(void* callable);
+	};
+
+	template <typename F>
+	static constexpr bool fitsInline = sizeof(F) <= Capacity
+		&& alignof(F) <= alignof(std::max_align_t)
+		&& std::is_nothrow_move_constructible_v<F>;
+
+	template <typename F> static F& inlineCallable(void* storage)
+	{
+		return *std::launder(reinterpret_cast<F*>(storage));
+	}
+
+	template <typename F> static F& heapCallable(void* storage)
+	{
+		return **std::launder(reinterpret_cast<F**>(storage));
+	}
+
+	template <typename F>
+	static inline const Operations INLINE_OPERATIONS {
+		.invoke = [](void* callable, Args&&... args) -> R
+		{
+			return std::invoke(
+				inlineCallable<F>(callable), std::forward<Args>(args)...);
+		},
+		.copy = [](void* to, const void* from)
+		{
+			new (to) F(inlineCallable<F>(const_cast<void*>(from)));
+		},
+		.move = [](void* to, void* from)
+		{
+			new (to) F(std::move(inlineCallable<F>(from)));
+			inlineCallable<F>(from).~F();
+		},
+		.destroy = [](void* callable)
+		{
+			inlineCallable<F>(callable).~F();
+		},
+	};
+
+	template <typename F>
+	static inline const Operations HEAP_OPERATIONS {
+		.invoke = [](void* callable, Args&&... args) -> R
+		{
+			return std::invoke(
+				heapCallable<F>(callable), std::forward<Args>(args)...);
+		},
+		.copy = [](void* to, const void* from)
+		{
+			new (to) F*(new F(heapCallable<F>(const_cast<void*>(from))));
+		},
+		.move = [](void* to, void* from)
+		{
+			new (to) F*(&heapCallable<F>(from));
+		},
+		.destroy = [](void* callable)
+		{
+			delete &heapCallable<F>(callable);
+		},
+	};
+
+	alignas(std::max_align_t) std::byte storage[Capacity];
+	const Operations* operations = nullptr;
+
+public:
+	InplaceFunction() = default;
+	InplaceFunction(std::nullptr_t) { }
+
+	template <typename F,
+		typename = std::enable_if_t<
+			!std::is_same_v<std::decay_t<F>, InplaceFunction>
+			&& std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+	InplaceFunction(F&& callable)
+	{
+		using Callable = std::decay_t<F>;
+		if constexpr (fitsInline<Callable>)
+		{
+			new (this->storage) Callable(std::forward<F>(callable));
+			this->operations = &INLINE_OPERATIONS<Callable>;
+		}
+		else
+		{
+			auto heap = new Callable(std::forward<F>(callable));
+			new (this->storage) Callable*(heap);
+			this->operations = &HEAP_OPERATIONS<Callable>;
+		}
+	}
+
+	InplaceFunction(const InplaceFunction& other)
+		: operations(other.operations)
+	{
+		if (this->operations)
+			this->operations->copy(this->storage, other.storage);
+	}
+
+	InplaceFunction(InplaceFunction&& other) noexcept
+		: operations(other.operations)
+	{
+		if (this->operations)
+			this->operations->move(this->storage, other.storage);
+		other.operations = nullptr;
+	}
+
+	~InplaceFunction() { this->reset(); }
+
+	InplaceFunction& operator=(const InplaceFunction& other)
+	{
+		if (this != &other)
+			*this = InplaceFunction(other);
+		return *this;
+	}
+
+	InplaceFunction& operator=(InplaceFunction&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+		this->reset();
+		this->operations = other.operations;
+		if (this->operations)
+			this->operations->move(this->storage, other.storage);
+		other.operations = nullptr;
+		return *this;
+	}
+
+	InplaceFunction& operator=(std::nullptr_t)
+	{
+		this->reset();
+		return *this;
+	}
+
+	void reset()
+	{
+		if (this->operations)
+			this->operations->destroy(this->storage);
+		this->operations = nullptr;
+	}
+
+	explicit operator bool() const { return this->operations != nullptr; }
+
+	R operator()(Args... args) const
+	{
+		if (!this->operations)
+			throw std::bad_function_call();
+		return this->operations->invoke(
+			const_cast<std::byte*>(this->storage), std::forward<Args>(args)...);
+	}
+};
+}
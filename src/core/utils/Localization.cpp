@@ -5,6 +5,59 @@
 #include <fmt/printf.h>
 #include <spdlog/spdlog.h>
 #include <regex>
+#include <unordered_map>
+#include <utility>
+
+namespace Localization
+{
+// language -> message -> translation with colors expanded
+static std::unordered_map<std::string,
+	std::unordered_map<std::string, std::string>>
+	gTranslations;
+
+static std::string expandTranslation(
+	const std::string& message, const std::string& language)
+{
+	auto& dict = Localization::getDictionary(
+		language, Localization::LANGUAGE_CHARSETS.at(language));
+	auto translation = dict.translate(message);
+	std::regex colorRegex("\\#[^#]+\\#");
+
+	for (std::smatch m; std::regex_search(translation, m, colorRegex);)
+	{
+		auto matchString = m.str();
+		auto colorName = matchString.substr(1, matchString.length() - 2);
+		if (!Core::Utils::COLORS.contains(colorName))
+		{
+			spdlog::error(fmt::sprintf("Color %s doesn't exist in COLORS map. "
+									   "The broken translation is:\n%s",
+				colorName, translation));
+			continue;
+		}
+		auto colorExpansion = Core::Utils::COLORS.at(colorName);
+		translation.replace(
+			m.position(), m.length(), fmt::sprintf("{%s}", colorExpansion));
+	}
+	return translation;
+}
+
+const std::string& translate(
+	const std::string& message, const std::string& language)
+{
+	if (!gDictionaryManager)
+		return message;
+
+	auto& translations = gTranslations[language];
+	auto translation = translations.find(message);
+	if (translation != translations.end())
+		return translation->second;
+
+	auto expanded = expandTranslation(message, language);
+	if (translations.size() >= TRANSLATION_CACHE_LIMIT)
+		translations.clear();
+	return translations.emplace(message, std::move(expanded)).first->second;
+}
+}
 
 std::string _(const std::string& message, IPlayer& player)
 {
@@ -15,25 +68,7 @@ std::string _(const std::string& message, IPlayer& player)
 	{
 		auto data = ext->getPlayerData();
 		if (data)
-		{
-			auto& dict = Localization::getDictionary(data->language, Localization::LANGUAGE_CHARSETS.at(data->language));
-			auto translation = dict.translate(message);
-			std::regex colorRegex("\\#[^#]+\\#");
-
-			for (std::smatch m; std::regex_search(translation, m, colorRegex);)
-			{
-				auto matchString = m.str();
-				auto colorName = matchString.substr(1, matchString.length() - 2);
-				if (!Core::Utils::COLORS.contains(colorName))
-				{
-					spdlog::error(fmt::sprintf("Color %s doesn't exist in COLORS map. The broken translation is:\n%s", colorName, translation));
-					continue;
-				}
-				auto colorExpansion = Core::Utils::COLORS.at(colorName);
-				translation.replace(m.position(), m.length(), fmt::sprintf("{%s}", colorExpansion));
-			}
-			return translation;
-		}
+			return Localization::translate(message, data->language);
 	}
 	return message;
-}
\ No newline at end of file
+}
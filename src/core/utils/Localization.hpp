@@ -3,6 +3,7 @@
 #include <tinygettext/dictionary_manager.hpp>
 #include <player.hpp>
 
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 #include <memory>
@@ -28,6 +29,18 @@ static inline tinygettext::Dictionary& getDictionary(
 	return Localization::gDictionaryManager->get_dictionary(
 		tinygettext::Language::from_name(lang), charset);
 }
+
+/// Translations of this many messages are cached per language, more than
+/// there are msgids, and the cache starts over once it is full, so messages
+/// that were formatted before being translated can't grow it without bound
+inline const std::size_t TRANSLATION_CACHE_LIMIT = 2048;
+
+/// Message translated into the language with its color names expanded.
+/// Translations are cached per language, so repeated lookups of the same
+/// message don't allocate. The returned reference is only valid until the
+/// next call. Main thread only.
+const std::string& translate(
+	const std::string& message, const std::string& language);
 }
 
 std::string _(const std::string& message, IPlayer& player);
@@ -0,0 +1,41 @@
+#include "Logging.hpp"
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string_view>
+
+namespace Core::Utils
+{
+void initLogging()
+{
+	spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+	auto logger = std::make_shared<spdlog::async_logger>("oasis",
+		std::make_shared<spdlog::sinks::stdout_color_sink_mt>(),
+		spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+	logger->set_pattern(LOG_PATTERN);
+	logger->flush_on(spdlog::level::warn);
+	spdlog::set_default_logger(logger);
+	spdlog::flush_every(LOG_FLUSH_INTERVAL);
+
+	auto level = spdlog::level::info;
+	if (auto levelName = std::getenv("LOG_LEVEL"))
+	{
+		// from_str falls back to off for anything it doesn't know
+		level = spdlog::level::from_str(levelName);
+		if (level == spdlog::level::off && std::string_view(levelName) != "off")
+		{
+			spdlog::warn("Unknown LOG_LEVEL '{}', using info", levelName);
+			level = spdlog::level::info;
+		}
+	}
+	spdlog::set_level(level);
+}
+
+void shutdownLogging()
+{
+	spdlog::shutdown();
+}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace Core::Utils
+{
+inline const std::size_t LOG_QUEUE_SIZE = 8192;
+inline const auto LOG_FLUSH_INTERVAL = std::chrono::seconds(5);
+inline const auto LOG_RATE_LIMIT_WINDOW = std::chrono::seconds(10);
+// messages per window and call site for events that happen per player
+inline const unsigned int LOG_PLAYER_EVENTS_LIMIT = 20;
+inline const auto LOG_PATTERN = "[%Y-%m-%d %H:%M:%S.%e] [%^%l%$] [%t] %v";
+
+/// Replaces the default logger with an asynchronous one: messages are put
+/// in a bounded ring and written out by a dedicated thread, when the ring is
+/// full the oldest messages are overwritten instead of blocking the caller.
+/// The level is read from LOG_LEVEL (trace, debug, info, warn, err,
+/// critical or off) and defaults to info.
+void initLogging();
+/// Writes out what is still queued and stops the logging thread
+void shutdownLogging();
+
+/// Lets through at most `limit` messages per LOG_RATE_LIMIT_WINDOW. Meant to
+/// be used through OASIS_LOG_LIMITED, one limiter per call site.
+class LogRateLimiter
+{
+	const unsigned int limit;
+	std::atomic<std::int64_t> windowStartedAt = 0;
+	std::atomic<unsigned int> count = 0;
+	std::atomic<unsigned int> suppressed = 0;
+
+public:
+	explicit LogRateLimiter(unsigned int limit)
+		: limit(limit)
+	{
+	}
+
+	/// When this call opens a new window, suppressedBefore is set to the
+	/// number of messages dropped in the previous one
+	bool allow(unsigned int& suppressedBefore)
+	{
+		using std::chrono::steady_clock;
+		auto now = steady_clock::now().time_since_epoch().count();
+		auto window = steady_clock::duration(LOG_RATE_LIMIT_WINDOW).count();
+		auto startedAt = this->windowStartedAt.load(std::memory_order_relaxed);
+		if (now - startedAt >= window
+			&& this->windowStartedAt.compare_exchange_strong(
+				startedAt, now, std::memory_order_relaxed))
+		{
+			suppressedBefore = this->suppressed.exchange(0);
+			this->count.store(0, std::memory_order_relaxed);
+		}
+
+		if (this->count.fetch_add(1, std::memory_order_relaxed) < this->limit)
+			return true;
+		this->suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+};
+}
+
+/// Logs at most `limit` messages per LOG_RATE_LIMIT_WINDOW from this call
+/// site and reports how many were dropped, for events that happen per player
+#define OASIS_LOG_LIMITED(level, limit, ...)                                   \
+	do                                                                         \
+	{                                                                          \
+		if (!spdlog::should_log(level))                                        \
+			break;                                                             \
+		static Core::Utils::LogRateLimiter oasisLogLimiter(limit);             \
+		unsigned int oasisLogSuppressed = 0;                                   \
+		bool oasisLogAllowed = oasisLogLimiter.allow(oasisLogSuppressed);      \
+		if (oasisLogSuppressed)                                                \
+			spdlog::log(level, "{} similar messages suppressed",               \
+				oasisLogSuppressed);                                           \
+		if (oasisLogAllowed)                                                   \
+			spdlog::log(level, __VA_ARGS__);                                   \
+	} while (0)
+
+/// Logs only every `n`-th message from this call site
+#define OASIS_LOG_SAMPLED(level, n, ...)                                       \
+	do                                                                         \
+	{                                                                          \
+		if (!spdlog::should_log(level))                                        \
+			break;                                                             \
+		static std::atomic<unsigned int> oasisLogSamples = 0;                  \
+		if (oasisLogSamples.fetch_add(1, std::memory_order_relaxed) % (n)      \
+			== 0)                                                              \
+			spdlog::log(level, __VA_ARGS__);                                   \
+	} while (0)
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <fmt/format.h>
+#include <fmt/printf.h>
+
+#include <string_view>
+
+namespace Core::Utils
+{
+/// Builds chat messages piece by piece in a buffer owned by the calling
+/// thread. The buffer keeps its capacity between messages, so once it has
+/// grown to fit the longest one building a message doesn't allocate, the
+/// text and the printf-style parts are written straight into it.
+/// Only one builder may be in use per thread at a time.
+class MessageBuilder
+{
+	fmt::memory_buffer& buffer;
+
+	static fmt::memory_buffer& threadBuffer()
+	{
+		thread_local fmt::memory_buffer buffer;
+		return buffer;
+	}
+
+public:
+	MessageBuilder()
+		: buffer(threadBuffer())
+	{
+		this->buffer.clear();
+	}
+
+	MessageBuilder(const MessageBuilder&) = delete;
+	MessageBuilder& operator=(const MessageBuilder&) = delete;
+
+	MessageBuilder& append(std::string_view text)
+	{
+		this->buffer.append(text.data(), text.data() + text.size());
+		return *this;
+	}
+
+	MessageBuilder& append(char ch)
+	{
+		this->buffer.push_back(ch);
+		return *this;
+	}
+
+	/// Appends the printf-style format, as fmt::sprintf would produce it
+	template <typename... T>
+	MessageBuilder& appendPrintf(std::string_view format, const T&... args)
+	{
+		// fmt::sprintf would format into a string first, the detail overload
+		// writes into the buffer we already have
+		fmt::detail::vprintf(this->buffer,
+			fmt::string_view(format.data(), format.size()),
+			fmt::printf_args(fmt::make_printf_args(args...)));
+		return *this;
+	}
+
+	std::string_view view() const
+	{
+		return std::string_view(this->buffer.data(), this->buffer.size());
+	}
+};
+}
@@ -0,0 +1,183 @@
+#include "Metrics.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace Core::Utils
+{
+Histogram::Histogram(std::vector<double> bounds)
+	: bounds(std::move(bounds))
+	, buckets(std::make_unique<std::atomic<std::uint64_t>[]>(
+		  this->bounds.size() + 1))
+{
+	std::sort(this->bounds.begin(), this->bounds.end());
+}
+
+void Histogram::observe(double value)
+{
+	auto bucket = std::lower_bound(this->bounds.begin(), this->bounds.end(),
+					  value)
+		- this->bounds.begin();
+	this->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	this->sum.fetch_add(value, std::memory_order_relaxed);
+	this->count.fetch_add(1, std::memory_order_relaxed);
+}
+
+MetricsRegistry::Series& MetricsRegistry::getSeries(const std::string& name,
+	const std::string& help, MetricType type, const std::string& labels)
+{
+	auto family = std::find_if(this->families.begin(), this->families.end(),
+		[&name](const Family& family)
+		{
+			return family.name == name;
+		});
+	if (family == this->families.end())
+	{
+		family = this->families.insert(this->families.end(),
+			Family { .name = name, .help = help, .type = type });
+	}
+	else if (family->type != type)
+		throw std::logic_error(
+			fmt::format("Metric {} is registered with another type", name));
+
+	auto series = std::find_if(family->series.begin(), family->series.end(),
+		[&labels](const Series& series)
+		{
+			return series.labels == labels;
+		});
+	if (series != family->series.end())
+		return *series;
+	return family->series.emplace_back(Series { .labels = labels });
+}
+
+Counter& MetricsRegistry::counter(
+	const std::string& name, const std::string& help, const std::string& labels)
+{
+	std::lock_guard lock(this->mutex);
+	auto& series = this->getSeries(name, help, MetricType::Counter, labels);
+	if (!series.counter)
+		series.counter = std::make_unique<Counter>();
+	return *series.counter;
+}
+
+Gauge& MetricsRegistry::gauge(
+	const std::string& name, const std::string& help, const std::string& labels)
+{
+	std::lock_guard lock(this->mutex);
+	auto& series = this->getSeries(name, help, MetricType::Gauge, labels);
+	if (!series.gauge)
+		series.gauge = std::make_unique<Gauge>();
+	return *series.gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name,
+	const std::string& help, const std::vector<double>& bounds,
+	const std::string& labels)
+{
+	std::lock_guard lock(this->mutex);
+	auto& series = this->getSeries(name, help, MetricType::Histogram, labels);
+	if (!series.histogram)
+		series.histogram = std::make_unique<Histogram>(bounds);
+	return *series.histogram;
+}
+
+void MetricsRegistry::callback(const std::string& name,
+	const std::string& help, MetricType type, std::function<double()> read,
+	const std::string& labels)
+{
+	if (type == MetricType::Histogram)
+		throw std::invalid_argument("Histograms can't be read by a callback");
+
+	std::lock_guard lock(this->mutex);
+	this->getSeries(name, help, type, labels).read = std::move(read);
+}
+
+std::optional<double> MetricsRegistry::value(
+	const std::string& name, const std::string& labels) const
+{
+	std::lock_guard lock(this->mutex);
+	for (const auto& family : this->families)
+	{
+		if (family.name != name)
+			continue;
+		for (const auto& series : family.series)
+		{
+			if (series.labels != labels)
+				continue;
+			if (series.read)
+				return series.read();
+			if (series.counter)
+				return series.counter->get();
+			if (series.gauge)
+				return series.gauge->get();
+		}
+	}
+	return std::nullopt;
+}
+
+std::string MetricsRegistry::render() const
+{
+	auto withLabels = [](const std::string& labels, const std::string& extra)
+	{
+		if (labels.empty() && extra.empty())
+			return std::string();
+		if (labels.empty() || extra.empty())
+			return "{" + labels + extra + "}";
+		return "{" + labels + "," + extra + "}";
+	};
+
+	std::lock_guard lock(this->mutex);
+	fmt::memory_buffer out;
+	auto inserter = std::back_inserter(out);
+	for (const auto& family : this->families)
+	{
+		fmt::format_to(inserter, "# HELP {} {}\n# TYPE {} {}\n", family.name,
+			family.help, family.name,
+			family.type == MetricType::Counter	   ? "counter"
+				: family.type == MetricType::Gauge ? "gauge"
+												   : "histogram");
+		for (const auto& series : family.series)
+		{
+			auto labels = withLabels(series.labels, "");
+			if (series.read)
+				fmt::format_to(
+					inserter, "{}{} {}\n", family.name, labels, series.read());
+			else if (series.counter)
+				fmt::format_to(inserter, "{}{} {}\n", family.name, labels,
+					series.counter->get());
+			else if (series.gauge)
+				fmt::format_to(inserter, "{}{} {}\n", family.name, labels,
+					series.gauge->get());
+			else if (series.histogram)
+			{
+				const auto& histogram = *series.histogram;
+				std::uint64_t cumulative = 0;
+				for (std::size_t i = 0; i <= histogram.bounds.size(); i++)
+				{
+					cumulative += histogram.buckets[i].load(
+						std::memory_order_relaxed);
+					auto bound = i < histogram.bounds.size()
+						? fmt::format("le=\"{}\"", histogram.bounds[i])
+						: std::string("le=\"+Inf\"");
+					fmt::format_to(inserter, "{}_bucket{} {}\n", family.name,
+						withLabels(series.labels, bound), cumulative);
+				}
+				fmt::format_to(inserter, "{}_sum{} {}\n{}_count{} {}\n",
+					family.name, labels,
+					histogram.sum.load(std::memory_order_relaxed), family.name,
+					labels, histogram.count.load(std::memory_order_relaxed));
+			}
+		}
+	}
+	return fmt::to_string(out);
+}
+
+MetricsRegistry& metrics()
+{
+	static MetricsRegistry registry;
+	return registry;
+}
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Core::Utils
+{
+/// Bucket bounds in seconds for anything measured on the main thread
+inline const std::vector<double> LATENCY_BUCKETS = { 0.0001, 0.00025,
+	0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 1.0 };
+
+enum class MetricType
+{
+	Counter,
+	Gauge,
+	Histogram
+};
+
+class Counter
+{
+	std::atomic<std::uint64_t> value = 0;
+
+public:
+	void increment(std::uint64_t by = 1)
+	{
+		this->value.fetch_add(by, std::memory_order_relaxed);
+	}
+
+	std::uint64_t get() const
+	{
+		return this->value.load(std::memory_order_relaxed);
+	}
+};
+
+class Gauge
+{
+	std::atomic<std::int64_t> value = 0;
+
+public:
+	void set(std::int64_t value)
+	{
+		this->value.store(value, std::memory_order_relaxed);
+	}
+
+	void add(std::int64_t by)
+	{
+		this->value.fetch_add(by, std::memory_order_relaxed);
+	}
+
+	std::int64_t get() const
+	{
+		return this->value.load(std::memory_order_relaxed);
+	}
+};
+
+class Histogram
+{
+	std::vector<double> bounds;
+	/// one per bound plus the +Inf one, not cumulative
+	std::unique_ptr<std::atomic<std::uint64_t>[]> buckets;
+	std::atomic<double> sum = 0.0;
+	std::atomic<std::uint64_t> count = 0;
+
+	friend class MetricsRegistry;
+
+public:
+	explicit Histogram(std::vector<double> bounds);
+
+	void observe(double value);
+
+	template <typename Rep, typename Period>
+	void observe(std::chrono::duration<Rep, Period> value)
+	{
+		this->observe(std::chrono::duration<double>(value).count());
+	}
+};
+
+/// Every metric the server exposes. Metrics are registered once, usually at
+/// start-up, and the references handed out stay valid for the lifetime of
+/// the registry, so updating them is a single relaxed atomic operation.
+/// The mutex only guards the list of metrics, it's taken on registration and
+/// by the exporter while rendering, never when a value changes.
+class MetricsRegistry
+{
+	struct Series
+	{
+		std::string labels;
+		std::unique_ptr<Counter> counter;
+		std::unique_ptr<Gauge> gauge;
+		std::unique_ptr<Histogram> histogram;
+		std::function<double()> read;
+	};
+
+	struct Family
+	{
+		std::string name;
+		std::string help;
+		MetricType type;
+		std::deque<Series> series;
+	};
+
+	std::deque<Family> families;
+	mutable std::mutex mutex;
+
+	Series& getSeries(const std::string& name, const std::string& help,
+		MetricType type, const std::string& labels);
+
+public:
+	/// Labels are given in the exposition format, e.g. mode="Deathmatch".
+	/// Registering the same name and labels again returns the same metric.
+	Counter& counter(const std::string& name, const std::string& help,
+		const std::string& labels = "");
+	Gauge& gauge(const std::string& name, const std::string& help,
+		const std::string& labels = "");
+	Histogram& histogram(const std::string& name, const std::string& help,
+		const std::vector<double>& bounds, const std::string& labels = "");
+	/// A counter or gauge whose value is read when exporting. It runs on the
+	/// exporting thread, so it may only read atomics.
+	void callback(const std::string& name, const std::string& help,
+		MetricType type, std::function<double()> read,
+		const std::string& labels = "");
+
+	/// Current value of a counter or gauge, nullopt for histograms and
+	/// metrics that aren't registered
+	std::optional<double> value(
+		const std::string& name, const std::string& labels = "") const;
+
+	/// Renders every metric in the Prometheus text exposition format
+	std::string render() const;
+};
+
+MetricsRegistry& metrics();
+}
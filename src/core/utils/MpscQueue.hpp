@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace Core::Utils
+{
+/// Bounded lock-free queue for any number of producer threads and a single
+/// consumer thread (D. Vyukov's bounded queue). Every cell carries a sequence
+/// number telling whose turn it is, so producers only contend on the enqueue
+/// position and the consumer never touches it. The capacity is rounded up to
+/// a power of two and is fixed, a full queue makes tryPush fail.
+template <typename T> class MpscQueue
+{
+	struct alignas(64) Cell
+	{
+		std::atomic<std::size_t> sequence;
+		T value;
+	};
+
+	std::unique_ptr<Cell[]> cells;
+	std::size_t mask;
+	alignas(64) std::atomic<std::size_t> enqueuePosition = 0;
+	alignas(64) std::size_t dequeuePosition = 0;
+
+public:
+	explicit MpscQueue(std::size_t capacity)
+	{
+		if (capacity < 2)
+			throw std::invalid_argument("MpscQueue capacity must be >= 2");
+		std::size_t size = 2;
+		while (size < capacity)
+			size <<= 1;
+
+		this->cells = std::make_unique<Cell[]>(size);
+		this->mask = size - 1;
+		for (std::size_t i = 0; i < size; i++)
+			this->cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	std::size_t capacity() const { return this->mask + 1; }
+
+	/// Any thread. Returns false if the queue is full, value is left as is
+	bool tryPush(T&& value)
+	{
+		Cell* cell;
+		auto position = this->enqueuePosition.load(std::memory_order_relaxed);
+		while (true)
+		{
+			cell = &this->cells[position & this->mask];
+			auto sequence = cell->sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<std::intptr_t>(sequence)
+				- static_cast<std::intptr_t>(position);
+			if (diff == 0)
+			{
+				if (this->enqueuePosition.compare_exchange_weak(
+						position, position + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false;
+			else
+				position
+					= this->enqueuePosition.load(std::memory_order_relaxed);
+		}
+
+		cell->value = std::move(value);
+		cell->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Consumer thread only. Returns false if nothing has been pushed yet
+	bool tryPop(T& value)
+	{
+		auto position = this->dequeuePosition;
+		auto& cell = this->cells[position & this->mask];
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+			return false;
+
+		value = std::move(cell.value);
+		// don't keep whatever the value owns alive until the cell is reused
+		cell.value = T();
+		cell.sequence.store(
+			position + this->mask + 1, std::memory_order_release);
+		this->dequeuePosition = position + 1;
+		return true;
+	}
+};
+}
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <uuid.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <random>
 
 namespace Core::Utils
@@ -15,4 +22,80 @@ inline uuids::uuid_random_generator getUuidGenerator()
 
 	return uuids::uuid_random_generator { generator };
 }
-}
\ No newline at end of file
+
+/// xoshiro128++ by D. Blackman and S. Vigna: 16 bytes of state and a handful
+/// of instructions per number. Good enough for gameplay, never use it for
+/// anything security related.
+class Xoshiro128pp
+{
+	std::array<std::uint32_t, 4> state;
+
+	static std::uint32_t rotl(std::uint32_t x, int k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+public:
+	typedef std::uint32_t result_type;
+
+	explicit Xoshiro128pp(std::uint64_t seed)
+	{
+		// splitmix64 spreads the seed over the whole state, so even similar
+		// seeds give unrelated sequences and the state is never all zero
+		for (std::size_t i = 0; i < this->state.size(); i += 2)
+		{
+			std::uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			z ^= z >> 31;
+			this->state[i] = std::uint32_t(z);
+			this->state[i + 1] = std::uint32_t(z >> 32);
+		}
+	}
+
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max()
+	{
+		return std::numeric_limits<result_type>::max();
+	}
+
+	result_type operator()()
+	{
+		auto& s = this->state;
+		const std::uint32_t result = rotl(s[0] + s[3], 7) + s[0];
+		const std::uint32_t t = s[1] << 9;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = rotl(s[3], 11);
+		return result;
+	}
+};
+
+/// Generator of the calling thread, seeded from std::random_device the first
+/// time the thread asks for it
+inline Xoshiro128pp& randomGenerator()
+{
+	thread_local Xoshiro128pp generator = []()
+	{
+		std::random_device device;
+		return Xoshiro128pp((std::uint64_t(device()) << 32) | device());
+	}();
+	return generator;
+}
+
+/// Uniform index in [0, count), count must not be zero
+inline std::size_t randomIndex(std::size_t count)
+{
+	// Lemire's multiply-shift, the bias is negligible for the sizes we use
+	return std::size_t((std::uint64_t(randomGenerator()()) * count) >> 32);
+}
+
+/// Uniform integer in [min, max]
+inline int randomInt(int min, int max)
+{
+	return min + int(randomIndex(std::size_t(max - min) + 1));
+}
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Core::Utils
+{
+/// Uniform planar grid over the San Andreas map. Entities are bucketed by
+/// their X/Y position, so range queries only have to look at the cells
+/// overlapping the search area instead of every entity on the server.
+template <typename Key, int CellSize = 250, int WorldExtent = 3000>
+class SpatialGrid
+{
+	static constexpr int GRID_SIZE = WorldExtent * 2 / CellSize;
+
+	struct Entry
+	{
+		Key key;
+		float x;
+		float y;
+	};
+
+	std::array<std::vector<Entry>, GRID_SIZE * GRID_SIZE> cells;
+	std::unordered_map<Key, int> keyCells;
+
+	static int cellCoord(float value)
+	{
+		int coord = static_cast<int>(
+			std::floor((value + WorldExtent) / static_cast<float>(CellSize)));
+		return std::clamp(coord, 0, GRID_SIZE - 1);
+	}
+
+	static int cellIndex(int cx, int cy) { return cy * GRID_SIZE + cx; }
+
+	void eraseFromCell(int cell, const Key& key)
+	{
+		auto& entries = this->cells[cell];
+		auto it = std::find_if(entries.begin(), entries.end(),
+			[&key](const Entry& entry)
+			{
+				return entry.key == key;
+			});
+		if (it == entries.end())
+			return;
+		*it = entries.back();
+		entries.pop_back();
+	}
+
+	template <typename F>
+	void visitCell(int cx, int cy, float x, float y, F&& callback) const
+	{
+		for (const auto& entry : this->cells[cellIndex(cx, cy)])
+		{
+			float dx = entry.x - x;
+			float dy = entry.y - y;
+			callback(entry.key, dx * dx + dy * dy);
+		}
+	}
+
+public:
+	void insert(const Key& key, const Vector3& position)
+	{
+		if (this->keyCells.contains(key))
+		{
+			this->update(key, position);
+			return;
+		}
+		int cell
+			= cellIndex(cellCoord(position.x), cellCoord(position.y));
+		this->cells[cell].push_back(Entry { key, position.x, position.y });
+		this->keyCells[key] = cell;
+	}
+
+	void update(const Key& key, const Vector3& position)
+	{
+		auto it = this->keyCells.find(key);
+		if (it == this->keyCells.end())
+		{
+			this->insert(key, position);
+			return;
+		}
+
+		int cell
+			= cellIndex(cellCoord(position.x), cellCoord(position.y));
+		if (cell == it->second)
+		{
+			for (auto& entry : this->cells[cell])
+			{
+				if (entry.key == key)
+				{
+					entry.x = position.x;
+					entry.y = position.y;
+					break;
+				}
+			}
+			return;
+		}
+
+		this->eraseFromCell(it->second, key);
+		this->cells[cell].push_back(Entry { key, position.x, position.y });
+		it->second = cell;
+	}
+
+	void remove(const Key& key)
+	{
+		auto it = this->keyCells.find(key);
+		if (it == this->keyCells.end())
+			return;
+		this->eraseFromCell(it->second, key);
+		this->keyCells.erase(it);
+	}
+
+	bool contains(const Key& key) const
+	{
+		return this->keyCells.contains(key);
+	}
+
+	std::size_t size() const { return this->keyCells.size(); }
+
+	void clear()
+	{
+		for (auto& cell : this->cells)
+			cell.clear();
+		this->keyCells.clear();
+	}
+
+	/// Calls callback(key, squaredDistance) for every entity within radius.
+	template <typename F>
+	void forEachInRadius(
+		const Vector3& center, float radius, F&& callback) const
+	{
+		float radiusSq = radius * radius;
+		int minX = cellCoord(center.x - radius);
+		int maxX = cellCoord(center.x + radius);
+		int minY = cellCoord(center.y - radius);
+		int maxY = cellCoord(center.y + radius);
+
+		for (int cy = minY; cy <= maxY; cy++)
+		{
+			for (int cx = minX; cx <= maxX; cx++)
+			{
+				this->visitCell(cx, cy, center.x, center.y,
+					[&](const Key& key, float distanceSq)
+					{
+						if (distanceSq <= radiusSq)
+							callback(key, distanceSq);
+					});
+			}
+		}
+	}
+
+	std::vector<Key> queryRadius(const Vector3& center, float radius) const
+	{
+		std::vector<Key> result;
+		this->forEachInRadius(center, radius,
+			[&result](const Key& key, float)
+			{
+				result.push_back(key);
+			});
+		return result;
+	}
+
+	/// Returns up to count entities closest to center, nearest first. The
+	/// search walks outwards ring by ring and stops as soon as no unvisited
+	/// cell can contain anything closer than the current candidates.
+	std::vector<Key> nearest(const Vector3& center, std::size_t count,
+		float maxRadius = WorldExtent * 2.0f) const
+	{
+		std::vector<std::pair<float, Key>> candidates;
+		if (count == 0)
+			return {};
+
+		float maxRadiusSq = maxRadius * maxRadius;
+		int originX = cellCoord(center.x);
+		int originY = cellCoord(center.y);
+		auto collect = [&](const Key& key, float distanceSq)
+		{
+			if (distanceSq <= maxRadiusSq)
+				candidates.emplace_back(distanceSq, key);
+		};
+		auto byDistance = [](const auto& a, const auto& b)
+		{
+			return a.first < b.first;
+		};
+
+		for (int ring = 0; ring < GRID_SIZE; ring++)
+		{
+			for (int cy = originY - ring; cy <= originY + ring; cy++)
+			{
+				if (cy < 0 || cy >= GRID_SIZE)
+					continue;
+				bool edgeRow = cy == originY - ring || cy == originY + ring;
+				int step = edgeRow ? 1 : ring * 2;
+				for (int cx = originX - ring; cx <= originX + ring;
+					 cx += std::max(step, 1))
+				{
+					if (cx < 0 || cx >= GRID_SIZE)
+						continue;
+					this->visitCell(cx, cy, center.x, center.y, collect);
+				}
+			}
+
+			// Anything in the next ring is at least ring * CellSize away
+			float reach = static_cast<float>(ring * CellSize);
+			if (reach * reach > maxRadiusSq)
+				break;
+			if (candidates.size() >= count)
+			{
+				std::nth_element(candidates.begin(),
+					candidates.begin() + (count - 1), candidates.end(),
+					byDistance);
+				if (candidates[count - 1].first <= reach * reach)
+					break;
+			}
+		}
+
+		std::size_t resultSize = std::min(count, candidates.size());
+		std::partial_sort(candidates.begin(),
+			candidates.begin() + resultSize, candidates.end(), byDistance);
+
+		std::vector<Key> result;
+		result.reserve(resultSize);
+		for (std::size_t i = 0; i < resultSize; i++)
+			result.push_back(candidates[i].second);
+		return result;
+	}
+};
+}
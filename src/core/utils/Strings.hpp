@@ -2,6 +2,7 @@
 
 #include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <sstream>
 #include <algorithm>
@@ -12,19 +13,20 @@ namespace Core::Utils
 {
 namespace Strings
 {
-	inline std::vector<std::string> split(std::string str, char separator)
+	inline std::vector<std::string> split(
+		std::string_view str, char separator)
 	{
 		std::vector<std::string> separatedStrings;
-		int startIndex = 0, endIndex = 0;
-		for (int i = 0; i <= str.size(); i++)
+		separatedStrings.reserve(
+			std::count(str.begin(), str.end(), separator) + 1);
+		std::size_t startIndex = 0;
+		for (std::size_t i = 0; i <= str.size(); i++)
 		{
-			if (str[i] == separator || i == str.size())
+			if (i == str.size() || str[i] == separator)
 			{
-				endIndex = i;
-				std::string temp;
-				temp.append(str, startIndex, endIndex - startIndex);
-				separatedStrings.push_back(temp);
-				startIndex = endIndex + 1;
+				separatedStrings.emplace_back(
+					str.substr(startIndex, i - startIndex));
+				startIndex = i + 1;
 			}
 		}
 		return separatedStrings;
@@ -104,5 +106,19 @@ namespace Strings
 		trim(s);
 		return s;
 	}
+
+	// trim from both ends (non-owning)
+	inline std::string_view trim_view(std::string_view s)
+	{
+		auto isSpace = [](char ch)
+		{
+			return std::isspace(static_cast<unsigned char>(ch));
+		};
+		while (!s.empty() && isSpace(s.front()))
+			s.remove_prefix(1);
+		while (!s.empty() && isSpace(s.back()))
+			s.remove_suffix(1);
+		return s;
+	}
 }
 }
\ No newline at end of file
@@ -0,0 +1,27 @@
+#include "TickArena.hpp"
+
+namespace Core::Utils
+{
+TickArena::TickArena()
+	: initialBuffer(std::make_unique<std::byte[]>(TICK_ARENA_INITIAL_SIZE))
+	, resource(initialBuffer.get(), TICK_ARENA_INITIAL_SIZE,
+		  std::pmr::new_delete_resource())
+{
+}
+
+std::pmr::memory_resource* TickArena::get()
+{
+	return &this->resource;
+}
+
+void TickArena::reset()
+{
+	this->resource.release();
+}
+
+TickArena& tickArena()
+{
+	static TickArena arena;
+	return arena;
+}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <fmt/format.h>
+#include <fmt/printf.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Core::Utils
+{
+inline constexpr std::size_t TICK_ARENA_INITIAL_SIZE = 64 * 1024;
+
+/// Bump allocator for scratch objects that never outlive the server tick
+/// they were created in, e.g. rows sorted while building a results table.
+/// Everything handed out is released at once at the end of the tick, and
+/// the first TICK_ARENA_INITIAL_SIZE bytes of each tick come from a buffer
+/// that is reused forever. Main thread only.
+///
+/// The round results, the spawn selection scratch vectors and the rows of
+/// dialogs that are rebuilt every time they are shown use it. Chat messages
+/// are built in MessageBuilder's thread buffer and dialog callbacks are
+/// InplaceFunctions, so neither needs it.
+class TickArena
+{
+	std::unique_ptr<std::byte[]> initialBuffer;
+	std::pmr::monotonic_buffer_resource resource;
+
+public:
+	TickArena();
+	TickArena(const TickArena&) = delete;
+	TickArena& operator=(const TickArena&) = delete;
+
+	std::pmr::memory_resource* get();
+	/// Frees everything allocated since the last reset, called once a tick
+	void reset();
+};
+
+TickArena& tickArena();
+
+template <typename T> using TransientVector = std::pmr::vector<T>;
+using TransientString = std::pmr::string;
+
+template <typename T> inline TransientVector<T> makeTransientVector()
+{
+	return TransientVector<T>(tickArena().get());
+}
+
+inline TransientString makeTransientString(std::string_view text = {})
+{
+	return TransientString(text.data(), text.size(), tickArena().get());
+}
+
+/// fmt::sprintf into a string from the tick arena. Short results are
+/// formatted on the stack, so only the arena is touched.
+template <typename... T>
+TransientString transientSprintf(std::string_view format, const T&... args)
+{
+	fmt::basic_memory_buffer<char, 128> buffer;
+	fmt::detail::vprintf(buffer,
+		fmt::string_view(format.data(), format.size()),
+		fmt::printf_args(fmt::make_printf_args(args...)));
+	return TransientString(buffer.data(), buffer.size(), tickArena().get());
+}
+}
@@ -0,0 +1,60 @@
+#include "WorkerPool.hpp"
+
+#include <utility>
+
+namespace Core::Utils
+{
+WorkerPool::WorkerPool(std::size_t threadCount)
+{
+	this->threads.reserve(threadCount);
+	for (std::size_t i = 0; i < threadCount; i++)
+		this->threads.emplace_back(&WorkerPool::run, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard lock(this->mutex);
+		this->stopping = true;
+		this->jobs.clear();
+	}
+	this->wakeUp.notify_all();
+	for (auto& thread : this->threads)
+		thread.join();
+}
+
+void WorkerPool::post(std::function<void()> job)
+{
+	{
+		std::lock_guard lock(this->mutex);
+		this->jobs.push_back(std::move(job));
+	}
+	this->wakeUp.notify_one();
+}
+
+std::size_t WorkerPool::pending()
+{
+	std::lock_guard lock(this->mutex);
+	return this->jobs.size();
+}
+
+void WorkerPool::run()
+{
+	std::unique_lock lock(this->mutex);
+	while (true)
+	{
+		this->wakeUp.wait(lock,
+			[this]()
+			{
+				return this->stopping || !this->jobs.empty();
+			});
+		if (this->stopping)
+			return;
+		auto job = std::move(this->jobs.front());
+		this->jobs.pop_front();
+		lock.unlock();
+		job();
+		lock.lock();
+	}
+}
+}
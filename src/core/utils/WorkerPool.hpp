@@ -0,0 +1,37 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Core::Utils
+{
+/// A fixed number of threads running jobs in the order they were queued.
+/// The destructor lets the running jobs finish, drops the queued ones and
+/// joins the threads, so nothing outlives the pool's owner.
+class WorkerPool
+{
+	std::mutex mutex;
+	std::condition_variable wakeUp;
+	std::deque<std::function<void()>> jobs;
+	bool stopping = false;
+	std::vector<std::thread> threads;
+
+	void run();
+
+public:
+	explicit WorkerPool(std::size_t threadCount);
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	void post(std::function<void()> job);
+	/// Jobs waiting for a free thread
+	std::size_t pending();
+};
+}
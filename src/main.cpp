@@ -1,13 +1,13 @@
 #include "core/CoreManager.hpp"
 #include "core/utils/dotenv.h"
 #include "core/utils/Localization.hpp"
+#include "core/utils/Logging.hpp"
 
 #include <player.hpp>
 #include <spdlog/spdlog.h>
 #include <tinygettext/dictionary_manager.hpp>
 #include <sdk.hpp>
 
-#include <ctime>
 #include <cstdlib>
 #include <memory>
 
@@ -59,7 +59,7 @@ public:
 	void onInit(IComponentList* components) override
 	{
 		dotenv::init();
-		spdlog::set_level(spdlog::level::debug);
+		Core::Utils::initLogging();
 
 		auto db_connection_string = getenv("DB_CONNECTION_STRING");
 		if (db_connection_string == NULL)
@@ -71,7 +71,6 @@ public:
 		this->coreManager = Core::CoreManager::create(
 			components, _core, playerPool, db_connection_string);
 
-		srand(time(NULL));
 		_core->printLn("Oasis Gamemode has initialized");
 	}
 
@@ -88,6 +87,7 @@ public:
 		{
 			this->coreManager.reset();
 		}
+		Core::Utils::shutdownLogging();
 	}
 
 	void free() override
@@ -0,0 +1,125 @@
+#include "CbugDetector.hpp"
+#include "../core/utils/Localization.hpp"
+
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace Modes
+{
+static bool isPressed(uint32_t newKeys, uint32_t oldKeys, uint32_t key)
+{
+	return (newKeys & key) && !(oldKeys & key);
+}
+
+CbugDetector::CbugDetector(ITimersComponent* timersComponent)
+	: histories(PLAYER_POOL_SIZE)
+{
+	this->timer = timersComponent->create(
+		new Impl::SimpleTimerHandler(
+			[this]()
+			{
+				this->unfreezeDue();
+			}),
+		CBUG_UNFREEZE_INTERVAL, true);
+}
+
+CbugDetector::~CbugDetector() { this->timer->kill(); }
+
+void CbugDetector::record(
+	KeyHistory& history, KeyAction action, Clock::time_point now)
+{
+	history.presses[history.next] = KeyPress { .time = now, .action = action };
+	history.next = (history.next + 1) % CBUG_KEY_HISTORY_SIZE;
+	history.size = std::min(history.size + 1, CBUG_KEY_HISTORY_SIZE);
+}
+
+bool CbugDetector::isCbug(
+	const KeyHistory& history, Clock::time_point now) const
+{
+	// walk back from the crouch that was just recorded
+	for (std::size_t i = 2; i <= history.size; i++)
+	{
+		const auto& press = history.presses[(history.next
+			+ CBUG_KEY_HISTORY_SIZE - i)
+			% CBUG_KEY_HISTORY_SIZE];
+		if (now - press.time > CBUG_WINDOW)
+			return false;
+		if (press.action == KeyAction::AimReleased)
+			return false;
+		if (press.action == KeyAction::FirePressed)
+			return true;
+	}
+	return false;
+}
+
+void CbugDetector::freeze(
+	IPlayer& player, KeyHistory& history, Clock::time_point now)
+{
+	player.setControllable(false);
+	player.sendGameText(
+		_("Don't use ~r~C-bug!", player), Milliseconds(3000), 5);
+	player.playSound(4604, Vector3(0.0, 0.0, 0.0));
+
+	auto deadline = now + CBUG_FREEZE_TIME;
+	history.frozenUntil = deadline;
+	this->unfreezes.push_back(Unfreeze { .deadline = deadline,
+		.player = Core::Player::PlayerHandle::of(player) });
+	std::push_heap(
+		this->unfreezes.begin(), this->unfreezes.end(), std::greater<>());
+}
+
+bool CbugDetector::onKeyStateChange(
+	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
+{
+	auto& history = this->histories[player.getID()];
+	if (history.frozenUntil)
+		return false;
+
+	auto now = Clock::now();
+	if (isPressed(newKeys, oldKeys, Key::FIRE))
+		this->record(history, KeyAction::FirePressed, now);
+	// on foot the handbrake key is the aim key
+	if (isPressed(oldKeys, newKeys, Key::HANDBRAKE))
+		this->record(history, KeyAction::AimReleased, now);
+	if (!isPressed(newKeys, oldKeys, Key::CROUCH))
+		return false;
+
+	this->record(history, KeyAction::CrouchPressed, now);
+	if (!this->isCbug(history, now))
+		return false;
+	this->freeze(player, history, now);
+	return true;
+}
+
+void CbugDetector::reset(IPlayer& player)
+{
+	auto& history = this->histories[player.getID()];
+	if (history.frozenUntil)
+		player.setControllable(true);
+	// the pending unfreeze no longer matches and gets dropped
+	history = KeyHistory {};
+}
+
+void CbugDetector::unfreezeDue()
+{
+	auto now = Clock::now();
+	while (!this->unfreezes.empty()
+		&& this->unfreezes.front().deadline <= now)
+	{
+		std::pop_heap(
+			this->unfreezes.begin(), this->unfreezes.end(), std::greater<>());
+		auto unfreeze = this->unfreezes.back();
+		this->unfreezes.pop_back();
+
+		auto& history = this->histories[unfreeze.player.slot];
+		if (history.frozenUntil != unfreeze.deadline)
+			continue;
+		history.frozenUntil.reset();
+		// somebody else may have the slot by now, they aren't frozen
+		if (auto player = unfreeze.player.get())
+			player->setControllable(true);
+	}
+}
+}
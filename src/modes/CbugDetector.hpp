@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../core/player/PlayerHandle.hpp"
+
+#include <Server/Components/Timers/timers.hpp>
+#include <player.hpp>
+#include <values.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Modes
+{
+/// crouching this soon after a shot, without lowering the weapon in
+/// between, is a C-bug
+inline const auto CBUG_WINDOW = std::chrono::milliseconds(1000);
+/// how long a player who C-bugged stays frozen
+inline const auto CBUG_FREEZE_TIME = std::chrono::milliseconds(1500);
+/// how often frozen players are checked for being due to move again
+inline const auto CBUG_UNFREEZE_INTERVAL = Milliseconds(50);
+/// key presses remembered per player
+inline const std::size_t CBUG_KEY_HISTORY_SIZE = 8;
+
+/// Catches players cancelling the shot animation by crouching (C-bug) in
+/// rooms where it isn't allowed, and freezes them for a moment. Key presses
+/// are kept with steady clock timestamps in a small ring per player, and
+/// every frozen player waits in a single deadline heap that one timer
+/// drains, instead of a timer per freeze. One detector is shared by all the
+/// modes, main thread only.
+class CbugDetector
+{
+public:
+	typedef std::chrono::steady_clock Clock;
+
+	CbugDetector(ITimersComponent* timersComponent);
+	~CbugDetector();
+
+	/// Records the key change of a player on foot in a room without C-bug.
+	/// Returns true if it completed a C-bug and the player got frozen.
+	bool onKeyStateChange(IPlayer& player, uint32_t newKeys, uint32_t oldKeys);
+
+	/// Forgets the player's keys and lets them move again if they are
+	/// frozen, for when they leave the room
+	void reset(IPlayer& player);
+
+private:
+	enum class KeyAction : std::uint8_t
+	{
+		FirePressed,
+		CrouchPressed,
+		AimReleased
+	};
+
+	struct KeyPress
+	{
+		Clock::time_point time;
+		KeyAction action;
+	};
+
+	struct KeyHistory
+	{
+		std::array<KeyPress, CBUG_KEY_HISTORY_SIZE> presses;
+		std::size_t next = 0;
+		std::size_t size = 0;
+		/// set while the player is frozen
+		std::optional<Clock::time_point> frozenUntil;
+	};
+
+	struct Unfreeze
+	{
+		Clock::time_point deadline;
+		Core::Player::PlayerHandle player;
+
+		bool operator>(const Unfreeze& other) const
+		{
+			return this->deadline > other.deadline;
+		}
+	};
+
+	ITimer* timer = nullptr;
+	std::vector<KeyHistory> histories;
+	/// min-heap on the deadline
+	std::vector<Unfreeze> unfreezes;
+
+	void record(KeyHistory& history, KeyAction action, Clock::time_point now);
+	bool isCbug(const KeyHistory& history, Clock::time_point now) const;
+	void freeze(IPlayer& player, KeyHistory& history, Clock::time_point now);
+	void unfreezeDue();
+};
+}
@@ -3,6 +3,7 @@
 #include "../core/utils/Localization.hpp"
 #include "../core/utils/Common.hpp"
 #include "../core/textdraws/Notification.hpp"
+#include "../core/DeferredQueue.hpp"
 #include "Modes.hpp"
 #include "deathmatch/DeathmatchController.hpp"
 
@@ -14,64 +15,62 @@
 
 namespace Modes
 {
-ModeBase::ModeBase(
-	Mode mode, std::shared_ptr<dp::event_bus> bus, IPlayerPool* playerPool)
+ModeBase::ModeBase(Mode mode, std::shared_ptr<Core::Utils::EventBus> bus,
+	IPlayerPool* playerPool)
 	: mode(mode)
 	, bus(bus)
-	, playerOnFireEventRegistration(
-		  bus->register_handler<Core::Utils::Events::PlayerOnFireEvent>(
-			  this, &ModeBase::onPlayerOnFire))
-	, x1ArenaWinRegistration(
-		  bus->register_handler<Core::Utils::Events::X1ArenaWin>(
-			  this, &ModeBase::onX1ArenaWin))
-	, duelWinRegistration(bus->register_handler<Core::Utils::Events::DuelWin>(
-		  this, &ModeBase::onDuelWin))
-	, playerJoinedModeSubsciption(
-		  bus->register_handler<Core::Utils::Events::PlayerJoinedMode>(
-			  this, &ModeBase::onPlayerJoinedMode))
-	, playerOnFireBeenKilledRegistration(
-		  bus->register_handler<Core::Utils::Events::PlayerOnFireBeenKilled>(
-			  this, &ModeBase::onPlayerOnFireBeenKilled))
 	, playerPool(playerPool)
+	, playersMetric(Core::Utils::metrics().gauge("oasis_mode_players",
+		  "Players in each mode",
+		  fmt::format("mode=\"{}\"", magic_enum::enum_name(mode))))
+	, roomsMetric(Core::Utils::metrics().gauge("oasis_mode_rooms",
+		  "Rooms of each mode",
+		  fmt::format("mode=\"{}\"", magic_enum::enum_name(mode))))
 {
-	playerPool->getPlayerDamageDispatcher().addEventHandler(this);
+	// the handlers are virtual, so modes override them instead of
+	// subscribing on their own
+	bus->subscribe<&ModeBase::onPlayerOnFire>(this);
+	bus->subscribe<&ModeBase::onPlayerOnFireBeenKilled>(this);
+	bus->subscribe<&ModeBase::onX1ArenaWin>(this);
+	bus->subscribe<&ModeBase::onDuelWin>(this);
+	bus->subscribe<&ModeBase::onPlayerJoinedMode>(this);
 }
 
 ModeBase::~ModeBase()
 {
-	this->bus->remove_handler(this->playerOnFireEventRegistration);
-	this->bus->remove_handler(this->playerOnFireBeenKilledRegistration);
-	this->bus->remove_handler(this->x1ArenaWinRegistration);
-	playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
+	this->bus->unsubscribe(this);
 }
 
 void ModeBase::onModeJoin(IPlayer& player, JoinData joinData)
 {
 	spdlog::info("Player {} has joined mode {}", player.getName().to_string(),
 		magic_enum::enum_name(mode));
-	this->players.emplace(&player);
-	this->bus->fire_event(Core::Utils::Events::PlayerJoinedMode {
+	this->players.insert(player);
+	this->playersMetric.set(this->players.size());
+	this->bus->fire(Core::Utils::Events::PlayerJoinedMode {
 		.player = player, .mode = this->mode, .joinData = joinData });
 }
 
 void ModeBase::onModeLeave(IPlayer& player)
 {
-	this->players.erase(&player);
+	this->players.erase(player);
+	this->playersMetric.set(this->players.size());
 	// spdlog::info("Player {} has left mode {}", player.getName().to_string(),
 	// magic_enum::enum_name(this->mode));
 }
 
 void ModeBase::onPlayerSave(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
 }
 
 void ModeBase::onPlayerLoad(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
 }
 
-void ModeBase::onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event)
+void ModeBase::onPlayerOnFire(
+	const Core::Utils::Events::PlayerOnFireEvent& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -83,7 +82,7 @@ void ModeBase::onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event)
 }
 
 void ModeBase::onPlayerOnFireBeenKilled(
-	Core::Utils::Events::PlayerOnFireBeenKilled event)
+	const Core::Utils::Events::PlayerOnFireBeenKilled& event)
 {
 	this->sendMessageToAll(
 		__("#LIME#>> #RED#PLAYER ON FIRE#LIGHT_GRAY#: %s(%d) "
@@ -92,7 +91,7 @@ void ModeBase::onPlayerOnFireBeenKilled(
 		event.player.getName().to_string(), event.player.getID());
 }
 
-void ModeBase::onX1ArenaWin(Core::Utils::Events::X1ArenaWin event)
+void ModeBase::onX1ArenaWin(const Core::Utils::Events::X1ArenaWin& event)
 {
 	this->sendMessageToAll(__("#LIME#>> #RED#X1#WHITE#: %s(%d) "
 							  "has defeated %s(%d) with %s (%.1f HP, %.1f AP, "
@@ -104,7 +103,8 @@ void ModeBase::onX1ArenaWin(Core::Utils::Events::X1ArenaWin event)
 		std::format("{:%OM:%OS}", event.fightDuration));
 }
 
-void ModeBase::onPlayerJoinedMode(Core::Utils::Events::PlayerJoinedMode event)
+void ModeBase::onPlayerJoinedMode(
+	const Core::Utils::Events::PlayerJoinedMode& event)
 {
 	switch (event.mode)
 	{
@@ -125,7 +125,8 @@ void ModeBase::onPlayerJoinedMode(Core::Utils::Events::PlayerJoinedMode event)
 			__("#LIME#>> #DEEP_SAFFRON#DM#LIGHT_GRAY#: %s(%d) "
 			   "has joined DM mode (/dm %d)"),
 			event.player.getName().to_string(), event.player.getID(),
-			std::get<unsigned int>(event.joinData[Deathmatch::ROOM_INDEX]) + 1);
+			std::get<unsigned int>(event.joinData.at(Deathmatch::ROOM_INDEX))
+				+ 1);
 		break;
 	}
 	default:
@@ -135,7 +136,7 @@ void ModeBase::onPlayerJoinedMode(Core::Utils::Events::PlayerJoinedMode event)
 	}
 }
 
-void ModeBase::onDuelWin(Core::Utils::Events::DuelWin event)
+void ModeBase::onDuelWin(const Core::Utils::Events::DuelWin& event)
 {
 	for (auto player : this->players)
 	{
@@ -152,18 +153,52 @@ void ModeBase::onDuelWin(Core::Utils::Events::DuelWin event)
 	}
 }
 
-void ModeBase::onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
+void ModeBase::onPlayerSpawn(IPlayer& player)
+{
+}
+
+void ModeBase::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
+{
+}
+
+void ModeBase::onPlayerKeyStateChange(
+	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
+{
+}
+
+void ModeBase::onPlayerDamage(IPlayer& player, IPlayer& to, float amount,
 	unsigned int weapon, BodyPart part)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	playerExt->showNotification(
-		fmt::sprintf("%s(%d)~n~~w~%.1f%%", to.getName().to_string(), to.getID(),
-			(to.getArmour() + to.getHealth()) - amount),
-		Core::TextDraws::NotificationPosition::Top, 3);
+	// a burst of hits only needs the last health readout, so the
+	// notification is coalesced per tick
+	auto notification
+		= fmt::sprintf("%s(%d)~n~~w~%.1f%%", to.getName().to_string(),
+			to.getID(), (to.getArmour() + to.getHealth()) - amount);
+	Core::DeferredQueue::Get()->post(player,
+		Core::DeferredKey::TopNotification,
+		[notification = std::move(notification)](IPlayer& player)
+		{
+			Core::Player::getPlayerExt(player)->showNotification(
+				notification, Core::TextDraws::NotificationPosition::Top, 3);
+		});
 	player.playSound(17802, Vector3(0.0, 0.0, 0.0));
 }
 
+void ModeBase::onDamageFlush(IPlayer& player, float amount)
+{
+}
+
 unsigned int ModeBase::playerCount() { return this->players.size(); }
 
 const Mode& ModeBase::getModeType() { return this->mode; }
+
+const Core::Player::PlayerSet& ModeBase::getPlayers() const
+{
+	return this->players;
+}
+
+const Core::Player::PlayerSet* ModeBase::getRoomPlayers(IPlayer& player)
+{
+	return nullptr;
+}
 }
\ No newline at end of file
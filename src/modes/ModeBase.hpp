@@ -2,45 +2,60 @@
 
 #include "../core/player/PlayerModel.hpp"
 #include "../core/player/PlayerExtension.hpp"
+#include "../core/player/PlayerSet.hpp"
 #include "Modes.hpp"
-#include "../core/utils/Events.hpp"
+#include "../core/utils/EventBus.hpp"
+#include "../core/utils/ConnectionPool.hpp"
+#include "../core/utils/Metrics.hpp"
 
-#include <eventbus/event_bus.hpp>
 #include <memory>
 #include <player.hpp>
 
 #include <set>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace Modes
 {
-struct ModeBase : public PlayerDamageEventHandler
+/// A game mode. Player events reach it through the mode event router, and
+/// only for players who are in the mode.
+struct ModeBase
 {
-	ModeBase(
-		Mode mode, std::shared_ptr<dp::event_bus> bus, IPlayerPool* playerPool);
+	ModeBase(Mode mode, std::shared_ptr<Core::Utils::EventBus> bus,
+		IPlayerPool* playerPool);
 	virtual ~ModeBase();
 
 	virtual void onModeSelect(IPlayer& player) = 0;
 	virtual void onModeJoin(IPlayer& player, JoinData joinData);
 	virtual void onModeLeave(IPlayer& player);
 	virtual void onPlayerSave(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn);
+		std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch);
 	virtual void onPlayerLoad(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn);
-	virtual void onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event);
+		std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch);
+	virtual void onPlayerOnFire(
+		const Core::Utils::Events::PlayerOnFireEvent& event);
 	virtual void onPlayerOnFireBeenKilled(
-		Core::Utils::Events::PlayerOnFireBeenKilled event);
-	virtual void onX1ArenaWin(Core::Utils::Events::X1ArenaWin event);
-	virtual void onPlayerJoinedMode(Core::Utils::Events::PlayerJoinedMode);
-	virtual void onDuelWin(Core::Utils::Events::DuelWin event);
+		const Core::Utils::Events::PlayerOnFireBeenKilled& event);
+	virtual void onX1ArenaWin(const Core::Utils::Events::X1ArenaWin& event);
+	virtual void onPlayerJoinedMode(
+		const Core::Utils::Events::PlayerJoinedMode& event);
+	virtual void onDuelWin(const Core::Utils::Events::DuelWin& event);
 
-	virtual void onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
-		unsigned int weapon, BodyPart part) override;
+	virtual void onPlayerSpawn(IPlayer& player);
+	virtual void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason);
+	virtual void onPlayerKeyStateChange(
+		IPlayer& player, uint32_t newKeys, uint32_t oldKeys);
+	/// Every hit dealt by a player in this mode
+	virtual void onPlayerDamage(IPlayer& player, IPlayer& to, float amount,
+		unsigned int weapon, BodyPart part);
+	/// Damage the player dealt since the last flush, summed up
+	virtual void onDamageFlush(IPlayer& player, float amount);
 
 	unsigned int playerCount();
 	const Mode& getModeType();
+	const Core::Player::PlayerSet& getPlayers() const;
+	/// Players of the room the player is in, nullptr if the mode has no rooms
+	virtual const Core::Player::PlayerSet* getRoomPlayers(IPlayer& player);
 
 	template <typename... T>
 	inline void sendMessageToAll(const std::string& message, T&&... args)
@@ -52,38 +67,22 @@ struct ModeBase : public PlayerDamageEventHandler
 		}
 	}
 
-	template <typename EventType, typename ClassType, typename MemberFunction>
-	inline dp::handler_registration hookEvent(
-		dp::handler_registration& registration, ClassType* classInstance,
-		MemberFunction&& memberFunction)
-	{
-		this->bus->remove_handler(registration);
-		return this->bus->register_handler<EventType>(
-			classInstance, memberFunction);
-	}
-
 	template <typename... T>
 	inline void sendModeMessage(
 		IPlayer& player, const std::string& message, T&&... args)
 	{
-		auto mode = this->getModeType();
-		player.sendClientMessage(Colour::White(),
-			fmt::sprintf("%s {%s}%s{FFFFFF}: %s", _("#LIME#>>#WHITE#", player),
-				Modes::getModeColor(mode), Modes::getModeShortName(mode),
-				fmt::sprintf(_(message, player), std::forward<T>(args)...)));
+		Core::Player::getPlayerExt(player)->sendModeMessage(
+			this->getModeType(), message, args...);
 	}
 
 protected:
-	std::unordered_set<IPlayer*> players;
+	Core::Player::PlayerSet players;
 	typedef ModeBase super;
 	Mode mode;
-	std::shared_ptr<dp::event_bus> bus;
+	std::shared_ptr<Core::Utils::EventBus> bus;
 	IPlayerPool* playerPool;
-
-	dp::handler_registration playerOnFireEventRegistration;
-	dp::handler_registration playerOnFireBeenKilledRegistration;
-	dp::handler_registration x1ArenaWinRegistration;
-	dp::handler_registration duelWinRegistration;
-	dp::handler_registration playerJoinedModeSubsciption;
+	Core::Utils::Gauge& playersMetric;
+	/// modes with rooms keep it at the number of rooms they have
+	Core::Utils::Gauge& roomsMetric;
 };
 }
\ No newline at end of file
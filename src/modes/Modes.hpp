@@ -2,6 +2,7 @@
 
 #include <ctime>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <variant>
 
@@ -23,7 +24,7 @@ enum class Mode
 	None
 };
 
-inline const std::string getModeShortName(Mode mode)
+inline constexpr std::string_view getModeShortName(Mode mode)
 {
 	switch (mode)
 	{
@@ -47,7 +48,7 @@ inline const std::string getModeShortName(Mode mode)
 	return "";
 };
 
-inline const std::string getModeColor(Mode mode)
+inline constexpr std::string_view getModeColor(Mode mode)
 {
 	switch (mode)
 	{
@@ -70,4 +71,53 @@ inline const std::string getModeColor(Mode mode)
 	}
 	return "FFFFFF";
 }
-}
\ No newline at end of file
+
+/// Colored short name of the mode as it appears in front of mode messages
+inline constexpr std::string_view getModeTag(Mode mode)
+{
+	switch (mode)
+	{
+	case Mode::Freeroam:
+		return "{A9C4E4}FR{FFFFFF}";
+	case Mode::Deathmatch:
+		return "{FF9933}DM{FFFFFF}";
+	case Mode::X1:
+		return "{FF0000}X1{FFFFFF}";
+	case Mode::Derby:
+		return "{FFFFFF}DB{FFFFFF}";
+	case Mode::PTP:
+		return "{FFFFFF}PTP{FFFFFF}";
+	case Mode::CnR:
+		return "{FFFFFF}CNR{FFFFFF}";
+	case Mode::None:
+		return "{FFFFFF}{FFFFFF}";
+	case Mode::Duel:
+		return "{789AB5}DUEL{FFFFFF}";
+	}
+	return "{FFFFFF}{FFFFFF}";
+}
+
+inline constexpr bool isModeTagConsistent(Mode mode)
+{
+	auto tag = getModeTag(mode);
+	auto color = getModeColor(mode);
+	auto name = getModeShortName(mode);
+	std::string_view reset = "{FFFFFF}";
+	return tag.size() == color.size() + name.size() + reset.size() + 2
+		&& tag.front() == '{' && tag.substr(1, color.size()) == color
+		&& tag[color.size() + 1] == '}'
+		&& tag.substr(color.size() + 2, name.size()) == name
+		&& tag.ends_with(reset);
+}
+
+inline constexpr bool areModeTagsConsistent()
+{
+	for (int mode = 0; mode <= static_cast<int>(Mode::None); mode++)
+		if (!isModeTagConsistent(static_cast<Mode>(mode)))
+			return false;
+	return true;
+}
+
+static_assert(areModeTagsConsistent(),
+	"getModeTag() must match getModeColor() and getModeShortName()");
+}
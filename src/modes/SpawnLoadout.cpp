@@ -0,0 +1,23 @@
+#include "SpawnLoadout.hpp"
+#include "../core/player/PlayerExtension.hpp"
+
+#include <cstddef>
+
+namespace Modes
+{
+void SpawnLoadout::update(
+	const std::array<PlayerWeapon, MAX_WEAPON_SLOTS>& weapons)
+{
+	for (std::size_t slot = 0; slot < weapons.size(); slot++)
+		this->spawnClass.weapons[slot] = WeaponSlotData(weapons[slot], 9999);
+}
+
+void SpawnLoadout::apply(IPlayer& player, const Vector4& spawnPoint) const
+{
+	PlayerClass spawnClass = this->spawnClass;
+	spawnClass.skin = Core::Player::getPlayerData(player)->lastSkinId;
+	spawnClass.spawn = Vector3(spawnPoint);
+	spawnClass.angle = spawnPoint.w;
+	queryExtension<IPlayerClassData>(player)->setSpawnInfo(spawnClass);
+}
+}
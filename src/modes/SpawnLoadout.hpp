@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Server/Components/Classes/classes.hpp>
+#include <player.hpp>
+#include <types.hpp>
+#include <values.hpp>
+
+#include <array>
+
+namespace Modes
+{
+/// The part of a room's spawn info that only changes with its settings.
+/// Rooms rebuild it whenever their weapons change, so a respawn only has
+/// to copy it and fill in the player's skin and spawn point.
+class SpawnLoadout
+{
+	PlayerClass spawnClass = PlayerClass(
+		0, TEAM_NONE, Vector3(0.0, 0.0, 0.0), 0.0, WeaponSlots {});
+
+public:
+	void update(const std::array<PlayerWeapon, MAX_WEAPON_SLOTS>& weapons);
+
+	/// Makes the player spawn at the point with the room's weapons
+	void apply(IPlayer& player, const Vector4& spawnPoint) const;
+};
+}
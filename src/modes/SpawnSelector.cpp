@@ -0,0 +1,82 @@
+#include "SpawnSelector.hpp"
+#include "../core/utils/Random.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace Modes
+{
+bool SpawnSelector::isRecent(std::size_t index, std::size_t count) const
+{
+	for (std::size_t i = 1; i <= count; i++)
+	{
+		auto slot = (this->historyNext + SPAWN_HISTORY_SIZE - i)
+			% SPAWN_HISTORY_SIZE;
+		if (this->history[slot] == index)
+			return true;
+	}
+	return false;
+}
+
+void SpawnSelector::remember(std::size_t index)
+{
+	this->history[this->historyNext] = index;
+	this->historyNext = (this->historyNext + 1) % SPAWN_HISTORY_SIZE;
+	this->historySize = std::min(this->historySize + 1, SPAWN_HISTORY_SIZE);
+}
+
+const Vector4& SpawnSelector::select(
+	const std::vector<Vector4>& spawnPoints, std::span<const Vector3> occupied)
+{
+	const auto count = spawnPoints.size();
+	// on small maps some of the recent points have to be allowed again
+	const auto avoided = std::min(this->historySize, count - 1);
+
+	std::size_t best = 0;
+	float bestDistance = -1.0;
+	std::size_t candidates = 0;
+	// a few draws more than needed, in case some land on recent points
+	for (std::size_t draw = 0;
+		draw < SPAWN_CANDIDATES * 2 && candidates < SPAWN_CANDIDATES; draw++)
+	{
+		auto index = Core::Utils::randomIndex(count);
+		if (this->isRecent(index, avoided))
+			continue;
+		candidates++;
+
+		// squared distance to the closest occupied position
+		float distance = std::numeric_limits<float>::max();
+		const auto& point = spawnPoints[index];
+		for (const auto& position : occupied)
+		{
+			float dx = point.x - position.x;
+			float dy = point.y - position.y;
+			float dz = point.z - position.z;
+			distance = std::min(distance, dx * dx + dy * dy + dz * dz);
+		}
+		if (distance > bestDistance)
+		{
+			best = index;
+			bestDistance = distance;
+		}
+	}
+
+	if (candidates == 0)
+	{
+		// unlucky draws, take the first point after a random one that
+		// wasn't used lately
+		best = Core::Utils::randomIndex(count);
+		while (this->isRecent(best, avoided))
+			best = (best + 1) % count;
+	}
+
+	this->remember(best);
+	return spawnPoints[best];
+}
+
+void SpawnSelector::reset()
+{
+	this->historySize = 0;
+	this->historyNext = 0;
+}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../core/utils/TickArena.hpp"
+
+#include <player.hpp>
+#include <types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Modes
+{
+/// how many of the last picked spawn points are avoided
+inline const std::size_t SPAWN_HISTORY_SIZE = 4;
+/// spawn points compared against each other on every pick
+inline const std::size_t SPAWN_CANDIDATES = 3;
+
+/// Picks spawn points for a room: a few random candidates are drawn, the ones
+/// used lately are skipped and the one farthest from every occupied position
+/// wins. Kept per room, so it remembers the room's latest spawns.
+class SpawnSelector
+{
+	std::array<std::size_t, SPAWN_HISTORY_SIZE> history {};
+	std::size_t historySize = 0;
+	std::size_t historyNext = 0;
+
+	bool isRecent(std::size_t index, std::size_t count) const;
+	void remember(std::size_t index);
+
+public:
+	const Vector4& select(const std::vector<Vector4>& spawnPoints,
+		std::span<const Vector3> occupied);
+
+	/// Keeps away from everyone in the room but the spawning player
+	template <typename Players>
+	const Vector4& select(const std::vector<Vector4>& spawnPoints,
+		const Players& players, const IPlayer& spawning)
+	{
+		auto occupied = Core::Utils::makeTransientVector<Vector3>();
+		occupied.reserve(players.size());
+		for (IPlayer* player : players)
+		{
+			if (player != &spawning)
+				occupied.push_back(player->getPosition());
+		}
+		return this->select(
+			spawnPoints, std::span<const Vector3>(occupied));
+	}
+
+	/// Forgets the history, for when the room switches to another map
+	void reset();
+};
+}
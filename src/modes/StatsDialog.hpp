@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../core/dialogs/DialogManager.hpp"
+#include "../core/utils/Localization.hpp"
+
+#include <fmt/format.h>
+#include <fmt/printf.h>
+#include <player.hpp>
+
+#include <memory>
+#include <string>
+
+namespace Modes
+{
+inline const std::string STATS_DIALOG_BODY
+	= __("#WHITE#- Player:\t\t\t\t\t%s (%d)\n"
+		 "- Score:\t\t\t\t\t\t%d\n"
+		 "- Highest kill streak:\t\t\t\t%d\n"
+		 "- Total kills:\t\t\t\t\t%d\n"
+		 "- Total deaths:\t\t\t\t\t%d\n"
+		 "- Ratio:\t\t\t\t\t\t%.2f\n"
+		 "- Hand kills:\t\t\t\t\t%d\n"
+		 "- Handheld weapon kills:\t\t\t%d\n"
+		 "- Melee kills:\t\t\t\t\t%d\n"
+		 "- Handgun kills:\t\t\t\t\t%d\n"
+		 "- Shotgun kills:\t\t\t\t\t%d\n"
+		 "- SMG kills:\t\t\t\t\t%d\n"
+		 "- Assault rifles kills:\t\t\t\t%d\n"
+		 "- Rifles kills:\t\t\t\t\t%d\n"
+		 "- Heavy weapon kills:\t\t\t\t%d\n"
+		 "- Explosives kills:\t\t\t\t%d");
+
+// Shared by the DM, X1 and duel stats dialogs, which only differ in title
+template <typename Stats>
+void showStatsDialog(Core::DialogManager& dialogManager, Core::DialogKind kind,
+	const std::string& title, IPlayer& player, IPlayer& target,
+	const Stats& stats)
+{
+	auto buildDialog = [&title, &player]()
+	{
+		return std::shared_ptr<Core::IDialog>(new Core::MessageDialog(
+			fmt::sprintf(DIALOG_HEADER_TITLE, _(title, player)),
+			Core::formatToSlots(_(STATS_DIALOG_BODY, player)),
+			_("OK", player), ""));
+	};
+
+	unsigned int ratioDeaths = stats.deaths == 0 ? 1 : stats.deaths;
+	dialogManager.showDialog(player, kind, buildDialog,
+		{ target.getName().to_string(), std::to_string(target.getID()),
+			std::to_string(stats.score),
+			std::to_string(stats.highestKillStreak),
+			std::to_string(stats.kills), std::to_string(stats.deaths),
+			fmt::format("{:.2f}", float(stats.kills) / float(ratioDeaths)),
+			std::to_string(stats.handKills),
+			std::to_string(stats.handheldWeaponKills),
+			std::to_string(stats.meleeKills),
+			std::to_string(stats.handgunKills),
+			std::to_string(stats.shotgunKills), std::to_string(stats.smgKills),
+			std::to_string(stats.assaultRiflesKills),
+			std::to_string(stats.riflesKills),
+			std::to_string(stats.heavyWeaponKills),
+			std::to_string(stats.explosivesKills) },
+		[](Core::DialogResult result)
+		{
+		});
+}
+}
@@ -1,4 +1,5 @@
 #include "DeathmatchController.hpp"
+#include "../StatsDialog.hpp"
 #include "Maps.hpp"
 #include "PlayerTempData.hpp"
 #include "Room.hpp"
@@ -7,6 +8,7 @@
 #include "../../core/utils/Localization.hpp"
 #include "../../core/player/PlayerExtension.hpp"
 #include "../../core/utils/Events.hpp"
+#include "../../core/utils/TickArena.hpp"
 #include "../../core/utils/Common.hpp"
 #include "../../core/utils/QueryNames.hpp"
 #include "../../core/dialogs/DialogManager.hpp"
@@ -30,16 +32,11 @@
 #include <Server/Components/Timers/Impl/timers_impl.hpp>
 #include <unordered_map>
 #include <uuid.h>
-#include <eventbus/event_bus.hpp>
 #include <scn/scan.h>
 
 #include <optional>
 #include <vector>
 
-#define PRESSED(newkeys, oldkeys, k)                                           \
-	(((newkeys & (k)) == (k)) && ((oldkeys & (k)) != (k)))
-
-#define CBUG_FREEZE_DELAY 1500
 #define DEFAULT_ROOM_ROUND_TIME_MIN 1
 
 namespace Modes::Deathmatch
@@ -48,9 +45,10 @@ DeathmatchController::DeathmatchController(
 	std::weak_ptr<Core::ModeManager> modeManager,
 	std::shared_ptr<Core::Commands::CommandManager> commandManager,
 	std::shared_ptr<Core::DialogManager> dialogManager, IPlayerPool* playerPool,
-	ITimersComponent* timersComponent, std::shared_ptr<dp::event_bus> bus,
-	cp::connection_pool& dbPool,
-	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool)
+	ITimersComponent* timersComponent,
+	std::shared_ptr<Core::Utils::EventBus> bus, cp::connection_pool& dbPool,
+	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool,
+	std::shared_ptr<CbugDetector> cbugDetector)
 	: super(Mode::Deathmatch, bus, playerPool)
 	, modeManager(modeManager)
 	, commandManager(commandManager)
@@ -59,38 +57,20 @@ DeathmatchController::DeathmatchController(
 	, _playerPool(playerPool)
 	, _timersComponent(timersComponent)
 	, dbPool(dbPool)
+	, cbugDetector(cbugDetector)
 	, virtualWorldIdPool(virtualWorldIdPool)
 {
-	_playerPool->getPlayerDamageDispatcher().addEventHandler(this);
-	_playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
-	_playerPool->getPlayerChangeDispatcher().addEventHandler(this);
 	_ticker = _timersComponent->create(
 		new Impl::SimpleTimerHandler(
 			std::bind(&DeathmatchController::onTick, this)),
 		Milliseconds(1000), true);
 
-	// re-register player on fire handler
-	this->bus->remove_handler(this->playerOnFireEventRegistration);
-	this->playerOnFireEventRegistration
-		= this->bus->register_handler<Core::Utils::Events::PlayerOnFireEvent>(
-			this, &DeathmatchController::onPlayerOnFire);
-
-	// re-register player on fire been killed handler
-	this->bus->remove_handler(this->playerOnFireBeenKilledRegistration);
-	this->playerOnFireBeenKilledRegistration
-		= this->bus
-			  ->register_handler<Core::Utils::Events::PlayerOnFireBeenKilled>(
-				  this, &DeathmatchController::onPlayerOnFireBeenKilled);
-
 	this->initRooms();
 	this->initCommand();
 }
 
 DeathmatchController::~DeathmatchController()
 {
-	_playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
-	_playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
-	_playerPool->getPlayerChangeDispatcher().removeEventHandler(this);
 	_ticker->kill();
 }
 
@@ -115,12 +95,9 @@ void DeathmatchController::onModeLeave(IPlayer& player)
 }
 
 void DeathmatchController::onPlayerSave(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(Core::Utils::SQL::Queries::UPDATE_DM_STATS)
-			.value(),
+	batch.exec_prepared(Core::Utils::SQL::Queries::UPDATE_DM_STATS,
 		data->dmStats->score, data->dmStats->highestKillStreak,
 		data->dmStats->kills, data->dmStats->deaths, data->dmStats->handKills,
 		data->dmStats->handheldWeaponKills, data->dmStats->meleeKills,
@@ -131,23 +108,20 @@ void DeathmatchController::onPlayerSave(
 }
 
 void DeathmatchController::onPlayerLoad(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	auto result = txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(
-				Core::Utils::SQL::Queries::LOAD_DM_STATS_FOR_PLAYER)
-			.value(),
+	batch.exec_prepared_then(
+		Core::Utils::SQL::Queries::LOAD_DM_STATS_FOR_PLAYER,
+		[data](const pqxx::result& result)
+		{
+			data->dmStats->updateFromRow(result[0]);
+		},
 		data->userId);
-	data->dmStats->updateFromRow(result[0]);
 }
 
 void DeathmatchController::onPlayerSpawn(IPlayer& player)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
 	auto pData = Core::Player::getPlayerData(player);
-	if (!playerExt->isInMode(Modes::Mode::Deathmatch))
-		return;
 	auto roomId = pData->tempData->deathmatch->roomId;
 	auto room = this->rooms.at(roomId);
 	this->setupRoomForPlayer(player, room);
@@ -156,11 +130,7 @@ void DeathmatchController::onPlayerSpawn(IPlayer& player)
 void DeathmatchController::onPlayerDeath(
 	IPlayer& player, IPlayer* killer, int reason)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
 	auto playerData = Core::Player::getPlayerData(player);
-	if (!playerExt->isInMode(Modes::Mode::Deathmatch))
-		return;
-
 	playerData->tempData->deathmatch->increaseDeaths();
 	playerData->dmStats->deaths += 1;
 	if (playerData->tempData->deathmatch->subsequentKills
@@ -257,61 +227,35 @@ void DeathmatchController::onPlayerDeath(
 void DeathmatchController::onPlayerKeyStateChange(
 	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	auto playerData = playerExt->getPlayerData();
-	if (!playerExt->isInMode(Modes::Mode::Deathmatch))
-		return;
-
+	auto playerData = Core::Player::getPlayerData(player);
 	if (player.getState() != PlayerState_OnFoot)
 		return;
 
 	auto roomId = playerData->tempData->deathmatch->roomId;
 	if (this->rooms.at(roomId)->cbugEnabled)
 		return;
-	using namespace std::chrono;
-	if (PRESSED(newKeys, oldKeys, Key::FIRE))
-	{
-		playerData->tempData->deathmatch->lastShootTime
-			= system_clock::to_time_t(system_clock::now());
-	}
-	else if (PRESSED(newKeys, oldKeys, Key::CROUCH))
-	{
-		auto lastShootTime = playerData->tempData->deathmatch->lastShootTime;
-		auto currentTimestamp = system_clock::to_time_t(system_clock::now());
-		if (currentTimestamp - lastShootTime < 1)
-		{
-			player.setControllable(false);
-			playerData->tempData->deathmatch->cbugging = true;
-			player.sendGameText(
-				_("Don't use ~r~C-bug!", player), Milliseconds(3000), 5);
-			player.playSound(4604, Vector3(0.0, 0.0, 0.0));
-
-			auto timerHandler = new Impl::SimpleTimerHandler(
-				[&player, playerData, this]()
-				{
-					player.setControllable(true);
-					playerData->tempData->deathmatch->cbugging = false;
-					playerData->tempData->deathmatch->cbugFreezeTimer.reset();
-				});
-			auto timer = _timersComponent->create(
-				timerHandler, Milliseconds(1500), false);
-			playerData->tempData->deathmatch->cbugFreezeTimer = timer;
-		}
-	}
+	this->cbugDetector->onKeyStateChange(player, newKeys, oldKeys);
 }
 
-void DeathmatchController::onPlayerGiveDamage(IPlayer& player, IPlayer& to,
-	float amount, unsigned int weapon, BodyPart part)
+void DeathmatchController::onDamageFlush(IPlayer& player, float amount)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	auto playerData = playerExt->getPlayerData();
-	if (!playerExt->isInMode(Modes::Mode::Deathmatch))
-		return;
+	auto playerData = Core::Player::getPlayerData(player);
 	playerData->tempData->deathmatch->damageInflicted += amount;
 }
 
+const Core::Player::PlayerSet* DeathmatchController::getRoomPlayers(
+	IPlayer& player)
+{
+	auto playerData = Core::Player::getPlayerData(player);
+	auto room = this->rooms.find(playerData->tempData->deathmatch->roomId);
+	if (room == this->rooms.end()
+		|| !room->second->players.contains(player))
+		return nullptr;
+	return &room->second->players;
+}
+
 void DeathmatchController::onPlayerOnFire(
-	Core::Utils::Events::PlayerOnFireEvent event)
+	const Core::Utils::Events::PlayerOnFireEvent& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -321,7 +265,7 @@ void DeathmatchController::onPlayerOnFire(
 }
 
 void DeathmatchController::onPlayerOnFireBeenKilled(
-	Core::Utils::Events::PlayerOnFireBeenKilled event)
+	const Core::Utils::Events::PlayerOnFireBeenKilled& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -454,23 +398,30 @@ void DeathmatchController::initRooms()
 				.defaultArmor = 100.0,
 			}) },
 	};
+	for (const auto& [roomId, room] : this->rooms)
+		room->loadout.update(room->allowedWeapons);
+	this->roomsMetric.set(this->rooms.size());
 }
 
 void DeathmatchController::showRoomSelectionDialog(
 	IPlayer& player, bool modeSelection)
 {
-	std::vector<std::vector<std::string>> items;
-	items.push_back({ _("Create custom room", player) });
+	using Core::Utils::transientSprintf;
+	auto items = Core::Utils::makeTransientVector<Core::TransientRow>();
+	items.reserve(this->rooms.size() + 1);
+	items.emplace_back().push_back(
+		Core::Utils::makeTransientString(_("Create custom room", player)));
 	for (auto [roomId, room] : this->rooms)
 	{
-		items.push_back({ fmt::sprintf("{999999}%d. {00FF00}%s", roomId + 1,
-							  room->map.name),
-			fmt::sprintf("{00FF00}%s",
-				room->weaponSet.toString(player).append(
-					room->cbugEnabled ? "" : _(" #RED#(NO CBUG)", player))),
-			fmt::sprintf(
-				"{00FF00}%s", room->host.value_or(_("Server", player))),
-			fmt::sprintf("{00FF00}%d", room->players.size()) });
+		auto& row = items.emplace_back();
+		row.push_back(transientSprintf(
+			"{999999}%d. {00FF00}%s", roomId + 1, room->map.name));
+		row.push_back(transientSprintf("{00FF00}%s%s",
+			room->weaponSet.toString(player),
+			room->cbugEnabled ? "" : _(" #RED#(NO CBUG)", player)));
+		row.push_back(transientSprintf(
+			"{00FF00}%s", room->host.value_or(_("Server", player))));
+		row.push_back(transientSprintf("{00FF00}%d", room->players.size()));
 	}
 	auto dialog = std::shared_ptr<Core::TabListHeadersDialog>(
 		new Core::TabListHeadersDialog(fmt::sprintf(DIALOG_HEADER_TITLE,
@@ -540,45 +491,8 @@ void DeathmatchController::showDeathmatchStatsDialog(
 {
 	auto anotherPlayer = this->_playerPool->get(id);
 	auto playerData = Core::Player::getPlayerData(*anotherPlayer);
-	auto body = __("#WHITE#- Player:\t\t\t\t\t%s (%d)\n"
-				   "- Score:\t\t\t\t\t\t%d\n"
-				   "- Highest kill streak:\t\t\t\t%d\n"
-				   "- Total kills:\t\t\t\t\t%d\n"
-				   "- Total deaths:\t\t\t\t\t%d\n"
-				   "- Ratio:\t\t\t\t\t\t%.2f\n"
-				   "- Hand kills:\t\t\t\t\t%d\n"
-				   "- Handheld weapon kills:\t\t\t%d\n"
-				   "- Melee kills:\t\t\t\t\t%d\n"
-				   "- Handgun kills:\t\t\t\t\t%d\n"
-				   "- Shotgun kills:\t\t\t\t\t%d\n"
-				   "- SMG kills:\t\t\t\t\t%d\n"
-				   "- Assault rifles kills:\t\t\t\t%d\n"
-				   "- Rifles kills:\t\t\t\t\t%d\n"
-				   "- Heavy weapon kills:\t\t\t\t%d\n"
-				   "- Explosives kills:\t\t\t\t%d");
-	int ratioDeaths = playerData->dmStats->deaths;
-	if (ratioDeaths == 0)
-		ratioDeaths = 1;
-	auto formattedBody = fmt::sprintf(_(body, player),
-		anotherPlayer->getName().to_string(), anotherPlayer->getID(),
-		playerData->dmStats->score, playerData->dmStats->highestKillStreak,
-		playerData->dmStats->kills, playerData->dmStats->deaths,
-		float(playerData->dmStats->kills) / float(ratioDeaths),
-		playerData->dmStats->handKills,
-		playerData->dmStats->handheldWeaponKills,
-		playerData->dmStats->meleeKills, playerData->dmStats->handgunKills,
-		playerData->dmStats->shotgunKills, playerData->dmStats->smgKills,
-		playerData->dmStats->assaultRiflesKills,
-		playerData->dmStats->riflesKills, playerData->dmStats->heavyWeaponKills,
-		playerData->dmStats->explosivesKills);
-
-	auto dialog = std::shared_ptr<Core::MessageDialog>(new Core::MessageDialog(
-		fmt::sprintf(DIALOG_HEADER_TITLE, _("DM stats", player)), formattedBody,
-		_("OK", player), ""));
-	this->dialogManager->showDialog(player, dialog,
-		[](Core::DialogResult result)
-		{
-		});
+	Modes::showStatsDialog(*this->dialogManager, Core::DialogKind::DeathmatchStats,
+		__("DM stats"), player, *anotherPlayer, *playerData->dmStats);
 }
 
 void DeathmatchController::showRoomCreationDialog(IPlayer& player)
@@ -703,10 +617,12 @@ void DeathmatchController::showRoomMapSelectionDialog(IPlayer& player)
 	if (!playerData->tempData->deathmatch->temporaryRoomSettings)
 		return;
 
-	std::vector<std::string> items;
+	auto items
+		= Core::Utils::makeTransientVector<Core::Utils::TransientString>();
+	items.reserve(MAPS.size());
 	for (const auto& map : MAPS)
 	{
-		items.push_back(map.name);
+		items.push_back(Core::Utils::makeTransientString(map.name));
 	}
 	auto dialog = std::shared_ptr<Core::ListDialog>(new Core::ListDialog(
 		fmt::sprintf(DIALOG_HEADER_TITLE, _("Map selection", player)), items,
@@ -875,7 +791,7 @@ void DeathmatchController::showRoomSetRoundTimeDialog(IPlayer& player)
 
 				try
 				{
-					minutes = std::stoi(result.inputText());
+					minutes = std::stoi(std::string(result.inputText()));
 				}
 				catch (std::exception&)
 				{
@@ -937,7 +853,7 @@ void DeathmatchController::showRoomSetHealthDialog(IPlayer& player)
 
 				try
 				{
-					hp = std::stoi(result.inputText());
+					hp = std::stoi(std::string(result.inputText()));
 				}
 				catch (std::exception&)
 				{
@@ -996,7 +912,7 @@ void DeathmatchController::showRoomSetArmorDialog(IPlayer& player)
 
 				try
 				{
-					armor = std::stoi(result.inputText());
+					armor = std::stoi(std::string(result.inputText()));
 				}
 				catch (std::exception&)
 				{
@@ -1126,7 +1042,10 @@ void DeathmatchController::createRoom(IPlayer& player)
 	auto room = playerData->tempData->deathmatch->temporaryRoomSettings;
 	room->virtualWorld = this->virtualWorldIdPool->allocateId();
 	auto roomId = this->roomIdPool->allocateId();
-	this->rooms[roomId] = std::make_shared<Room>(*room);
+	auto createdRoom = std::make_shared<Room>(*room);
+	createdRoom->loadout.update(createdRoom->allowedWeapons);
+	this->rooms[roomId] = createdRoom;
+	this->roomsMetric.set(this->rooms.size());
 	this->modeManager.lock()->joinMode(
 		player, Mode::Deathmatch, { { ROOM_INDEX, roomId } });
 }
@@ -1139,6 +1058,7 @@ void DeathmatchController::deleteRoom(unsigned int roomId)
 	if (room->roundStartTimer.has_value())
 		room->roundStartTimer.value()->kill();
 	this->rooms.erase(roomId);
+	this->roomsMetric.set(this->rooms.size());
 	this->roomIdPool->freeId(roomId);
 	this->virtualWorldIdPool->freeId(room->virtualWorld);
 }
@@ -1197,7 +1117,7 @@ void DeathmatchController::onRoomJoin(IPlayer& player, unsigned int roomId)
 
 	playerData->tempData->deathmatch = std::make_unique<PlayerTempData>();
 	playerData->tempData->deathmatch->roomId = roomId;
-	room->players.emplace(&player);
+	room->players.insert(player);
 	player.setHealth(room->defaultHealth);
 	player.setArmour(room->defaultArmor);
 	player.resetWeapons();
@@ -1246,7 +1166,10 @@ void DeathmatchController::onNewRound(std::shared_ptr<Room> room)
 	auto weaponSet = room->weaponSet;
 
 	if (room->randomMap)
+	{
 		room->map = randomlySelectMap(weaponSet);
+		room->spawnSelector.reset();
+	}
 	room->countdown = room->defaultTime;
 	room->isRestarting = false;
 	room->isStarting = true;
@@ -1293,7 +1216,10 @@ void DeathmatchController::onNewRound(std::shared_ptr<Room> room)
 void DeathmatchController::onRoundEnd(std::shared_ptr<Room> room)
 {
 	room->isRestarting = true;
-	std::vector<DeathmatchResult> resultArray;
+	// damage is handed over in batches, the results need all of it
+	this->modeManager.lock()->flushDamage();
+	auto resultArray = Core::Utils::makeTransientVector<DeathmatchResult>();
+	resultArray.reserve(room->players.size());
 	for (auto player : room->players)
 	{
 		auto playerData = Core::Player::getPlayerData(*player);
@@ -1304,18 +1230,13 @@ void DeathmatchController::onRoundEnd(std::shared_ptr<Room> room)
 			.damageInflicted
 			= playerData->tempData->deathmatch->damageInflicted });
 	}
-	std::sort(resultArray.begin(), resultArray.end(),
-		[](DeathmatchResult x1, DeathmatchResult x2)
-		{
-			if (x1.kills != x2.kills)
-				return x1.kills > x2.kills;
-			return x1.damageInflicted > x2.damageInflicted;
-		});
+	std::sort(resultArray.begin(), resultArray.end(), ranksHigher);
 
 	std::vector<std::vector<std::string>> lastResults;
+	lastResults.reserve(resultArray.size());
 	for (std::size_t i = 0; i < resultArray.size(); i++)
 	{
-		auto playerResult = resultArray.at(i);
+		const auto& playerResult = resultArray[i];
 		lastResults.push_back(
 			{ fmt::sprintf("{%06x}%d. %s",
 				  playerResult.player->getColour().RGBA() >> 8, i + 1,
@@ -1325,9 +1246,9 @@ void DeathmatchController::onRoundEnd(std::shared_ptr<Room> room)
 				fmt::sprintf("%.2f", playerResult.ratio),
 				fmt::sprintf("%.2f", playerResult.damageInflicted) });
 	}
-	room->cachedLastResult = lastResults;
+	room->cachedLastResult = std::move(lastResults);
 
-	for (auto& player : room->players)
+	for (auto player : room->players)
 	{
 		player->setControllable(false);
 		player->setSpectating(true);
@@ -1343,31 +1264,16 @@ void DeathmatchController::onRoundEnd(std::shared_ptr<Room> room)
 			std::bind(&DeathmatchController::onNewRound, this, room)),
 		Seconds(5), false);
 
-	this->bus->fire_event(Core::Utils::Events::RoundEndEvent {
+	this->bus->fire(Core::Utils::Events::RoundEndEvent {
 		.mode = this->mode, .players = room->players });
 }
 
 void DeathmatchController::setRandomSpawnPoint(
 	IPlayer& player, std::shared_ptr<Room> room)
 {
-	std::random_device rd;
-	std::mt19937 gen(rd());
-	std::uniform_int_distribution<> dis(0, room->map.spawnPoints.size() - 1);
-
-	int spawnPointIndex = dis(rd);
-	auto spawnPoint = room->map.spawnPoints[spawnPointIndex];
-	auto classData = queryExtension<IPlayerClassData>(player);
-	std::vector<WeaponSlotData> slotsVector;
-	for (const auto& weapon : room->allowedWeapons)
-	{
-		slotsVector.push_back(WeaponSlotData(weapon, 9999));
-	}
-	WeaponSlots weaponSlots;
-	std::ranges::copy(
-		slotsVector.begin(), slotsVector.end(), weaponSlots.begin());
-	classData->setSpawnInfo(
-		PlayerClass(Core::Player::getPlayerData(player)->lastSkinId, TEAM_NONE,
-			Vector3(spawnPoint), spawnPoint.w, weaponSlots));
+	const auto& spawnPoint = room->spawnSelector.select(
+		room->map.spawnPoints, room->players, player);
+	room->loadout.apply(player, spawnPoint);
 }
 
 void DeathmatchController::setupRoomForPlayer(
@@ -1385,7 +1291,8 @@ void DeathmatchController::removePlayerFromRoom(IPlayer& player)
 	auto pData = Core::Player::getPlayerData(player);
 	auto roomId = pData->tempData->deathmatch->roomId;
 	auto room = this->rooms.at(roomId);
-	room->players.erase(&player);
+	room->players.erase(player);
+	this->cbugDetector->reset(player);
 	this->onRoomLeave(player, roomId);
 
 	pData->tempData->deathmatch.reset();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../CbugDetector.hpp"
 #include "../ModeBase.hpp"
 #include "../../core/ModeManager.hpp"
 #include "../../core/commands/CommandManager.hpp"
@@ -14,7 +15,6 @@
 #include <cstddef>
 #include <map>
 #include <player.hpp>
-#include <eventbus/event_bus.hpp>
 #include <pqxx/pqxx>
 
 #include <memory>
@@ -27,9 +27,7 @@ inline const std::string MODE_NAME = "deathmatch";
 inline const auto DEFAULT_WEAPON_SET = WeaponSet(WeaponSet::Value::Run);
 inline const std::string ROOM_INDEX = "roomIndex";
 
-class DeathmatchController : public Modes::ModeBase,
-							 public PlayerSpawnEventHandler,
-							 public PlayerChangeEventHandler
+class DeathmatchController : public Modes::ModeBase
 {
 	void initCommand();
 	void initRooms();
@@ -77,6 +75,7 @@ class DeathmatchController : public Modes::ModeBase,
 	IPlayerPool* _playerPool;
 	ITimersComponent* _timersComponent;
 	cp::connection_pool& dbPool;
+	std::shared_ptr<CbugDetector> cbugDetector;
 
 	ITimer* _ticker;
 
@@ -85,28 +84,30 @@ public:
 		std::shared_ptr<Core::Commands::CommandManager> commandManager,
 		std::shared_ptr<Core::DialogManager> dialogManager,
 		IPlayerPool* playerPool, ITimersComponent* timersComponent,
-		std::shared_ptr<dp::event_bus> bus, cp::connection_pool& dbPool,
-		std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool);
+		std::shared_ptr<Core::Utils::EventBus> bus, cp::connection_pool& dbPool,
+		std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool,
+		std::shared_ptr<CbugDetector> cbugDetector);
 	virtual ~DeathmatchController();
 
 	void onModeJoin(IPlayer& player,
 		std::unordered_map<std::string, Core::PrimitiveType> joinData) override;
 	void onModeSelect(IPlayer& player) override;
 	void onModeLeave(IPlayer& player) override;
-	void onPlayerSave(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
-	void onPlayerLoad(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
+	void onPlayerSave(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
+	void onPlayerLoad(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
 
 	void onPlayerSpawn(IPlayer& player) override;
 	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
 	void onPlayerKeyStateChange(
 		IPlayer& player, uint32_t newKeys, uint32_t oldKeys) override;
-	virtual void onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
-		unsigned int weapon, BodyPart part) override;
+	void onDamageFlush(IPlayer& player, float amount) override;
+	const Core::Player::PlayerSet* getRoomPlayers(IPlayer& player) override;
 
-	void onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event) override;
+	void onPlayerOnFire(
+		const Core::Utils::Events::PlayerOnFireEvent& event) override;
 	void onPlayerOnFireBeenKilled(
-		Core::Utils::Events::PlayerOnFireBeenKilled event) override;
+		const Core::Utils::Events::PlayerOnFireBeenKilled& event) override;
 };
 }
\ No newline at end of file
@@ -14,4 +14,13 @@ struct DeathmatchResult
 	float ratio;
 	float damageInflicted;
 };
+
+/// Order of the round results, most kills first and the damage dealt
+/// breaking ties
+inline bool ranksHigher(const DeathmatchResult& x1, const DeathmatchResult& x2)
+{
+	if (x1.kills != x2.kills)
+		return x1.kills > x2.kills;
+	return x1.damageInflicted > x2.damageInflicted;
+}
 }
\ No newline at end of file
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "WeaponSet.hpp"
+#include "../../core/utils/Random.hpp"
 
 #include <player.hpp>
-#include <random>
 #include <ranges>
 #include <types.hpp>
 #include <string>
@@ -19,12 +19,8 @@ struct Map
 
 	inline Vector4 getRandomSpawn()
 	{
-		std::random_device rd;
-		std::mt19937 gen(rd());
-		std::uniform_int_distribution<> dis(0, this->spawnPoints.size() - 1);
-
-		int spawnPointIndex = dis(rd);
-		return this->spawnPoints[spawnPointIndex];
+		return this->spawnPoints[Core::Utils::randomIndex(
+			this->spawnPoints.size())];
 	}
 };
 
@@ -260,16 +256,16 @@ inline const std::vector<Map> MAPS
 
 inline const Map randomlySelectMap(WeaponSet set)
 {
-	std::random_device rd;
-	std::mt19937 gen(rd());
-
 	auto mapSet = MAPS
 		| std::ranges::views::filter(
-			[&](Map map)
+			[&](const Map& map)
 			{
 				return map.weaponSet == set;
 			});
-	std::uniform_int_distribution<> dis(0, mapSet.base().size() - 1);
-	return mapSet.base()[dis(rd)];
+	auto count = std::ranges::distance(mapSet);
+	if (count == 0)
+		return MAPS[Core::Utils::randomIndex(MAPS.size())];
+	return *std::ranges::next(
+		mapSet.begin(), Core::Utils::randomIndex(count));
 };
 };
\ No newline at end of file
@@ -1,9 +1,7 @@
 #pragma once
 
 #include "Room.hpp"
-#include "Server/Components/Timers/timers.hpp"
 #include <cstddef>
-#include <ctime>
 #include <optional>
 #include <string>
 
@@ -12,9 +10,6 @@ namespace Modes::Deathmatch
 struct PlayerTempData
 {
 	unsigned int roomId;
-	std::time_t lastShootTime = 0;
-	bool cbugging = false;
-	std::optional<ITimer*> cbugFreezeTimer;
 	std::optional<Room> temporaryRoomSettings; // used for rooms creating
 
 	unsigned int kills = 0;
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Maps.hpp"
+#include "../../core/player/PlayerSet.hpp"
+#include "../SpawnLoadout.hpp"
+#include "../SpawnSelector.hpp"
 #include "Server/Components/Timers/timers.hpp"
 #include "WeaponSet.hpp"
 #include "values.hpp"
@@ -12,7 +15,6 @@
 
 #include <ratio>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
 namespace Modes::Deathmatch
@@ -69,7 +71,7 @@ struct Room
 	WeaponSet weaponSet;
 
 	/// A list of players which joined the room.
-	std::unordered_set<IPlayer*> players;
+	Core::Player::PlayerSet players;
 
 	/// Room host is a player who created the room. Set to 'Server' if this is
 	/// server-created room.
@@ -112,5 +114,11 @@ struct Room
 	void sendMessageToAll(const std::string& message, T&&... args);
 
 	std::optional<ITimer*> deletionTimer;
+
+	/// Picks spawn points away from the other players
+	SpawnSelector spawnSelector;
+
+	/// Spawn weapons, rebuilt from allowedWeapons when the room is set up
+	SpawnLoadout loadout;
 };
 }
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include "DuelController.hpp"
+#include "../StatsDialog.hpp"
 #include "./Maps.hpp"
 #include "../deathmatch/DeathmatchResult.hpp"
 #include "../../core/player/PlayerExtension.hpp"
 #include "../../core/utils/Common.hpp"
+#include "../../core/utils/TickArena.hpp"
 #include "../../core/utils/QueryNames.hpp"
 #include "../../core/SQLQueryManager.hpp"
 #include "DuelOffer.hpp"
@@ -65,8 +67,8 @@ void DuelController::createDuel(IPlayer& player, int id)
 			.roundCount = 1,
 			.defaultHealth = 100.0,
 			.defaultArmor = 100.0,
-			.from = &player,
-			.to = receivingPlayer,
+			.from = Core::Player::PlayerHandle::of(player),
+			.to = Core::Player::PlayerHandle::of(*receivingPlayer),
 		});
 	this->showDuelCreationDialog(player);
 }
@@ -74,12 +76,15 @@ void DuelController::createDuel(IPlayer& player, int id)
 unsigned int DuelController::createDuelRoom(std::shared_ptr<DuelOffer> offer)
 {
 	auto roomId = this->roomIdPool->allocateId();
-	this->rooms[roomId] = std::shared_ptr<Room>(new Room { .map = offer->map,
+	auto room = std::shared_ptr<Room>(new Room { .map = offer->map,
 		.allowedWeapons = offer->weaponSet.getWeapons(),
 		.virtualWorld = this->virtualWorldIdPool->allocateId(),
 		.defaultHealth = offer->defaultHealth,
 		.defaultArmor = offer->defaultArmor,
 		.maxRounds = offer->roundCount });
+	room->loadout.update(room->allowedWeapons);
+	this->rooms[roomId] = room;
+	this->roomsMetric.set(this->rooms.size());
 	return roomId;
 }
 
@@ -109,6 +114,7 @@ void DuelController::deleteDuel(unsigned int id, IPlayer* initiator)
 	if (room->roundStartTimer.has_value())
 		room->roundStartTimer.value()->kill();
 	this->rooms.erase(id);
+	this->roomsMetric.set(this->rooms.size());
 	this->roomIdPool->freeId(id);
 	this->virtualWorldIdPool->freeId(room->virtualWorld);
 }
@@ -116,18 +122,7 @@ void DuelController::deleteDuel(unsigned int id, IPlayer* initiator)
 void DuelController::setSpawnPoint(
 	IPlayer& player, std::shared_ptr<Room> room, Vector4& spawnPoint)
 {
-	auto classData = queryExtension<IPlayerClassData>(player);
-	std::vector<WeaponSlotData> slotsVector;
-	for (const auto& weapon : room->allowedWeapons)
-	{
-		slotsVector.push_back(WeaponSlotData(weapon, 9999));
-	}
-	WeaponSlots weaponSlots;
-	std::ranges::copy(
-		slotsVector.begin(), slotsVector.end(), weaponSlots.begin());
-	classData->setSpawnInfo(
-		PlayerClass(Core::Player::getPlayerData(player)->lastSkinId, TEAM_NONE,
-			Vector3(spawnPoint), spawnPoint.w, weaponSlots));
+	room->loadout.apply(player, spawnPoint);
 }
 
 void DuelController::setupRoomForPlayer(
@@ -229,7 +224,8 @@ void DuelController::createDuelOffer(IPlayer& player)
 		return;
 	auto tempDuelSettings
 		= playerData->tempData->core->temporaryDuelSettings.value();
-	if (tempDuelSettings->to->getID() == -1)
+	auto receivingPlayer = tempDuelSettings->to.get();
+	if (!receivingPlayer)
 	{
 		playerExt->sendErrorMessage(
 			__("The player you want to call for a duel has disconnected!"));
@@ -237,9 +233,8 @@ void DuelController::createDuelOffer(IPlayer& player)
 	}
 	playerData->tempData->core->duelOfferSent = tempDuelSettings;
 	playerData->tempData->core->temporaryDuelSettings.reset();
-	auto receivingPlayerData
-		= Core::Player::getPlayerData(*tempDuelSettings->to);
-	auto receivingPlayerExt = Core::Player::getPlayerExt(*tempDuelSettings->to);
+	auto receivingPlayerData = Core::Player::getPlayerData(*receivingPlayer);
+	auto receivingPlayerExt = Core::Player::getPlayerExt(*receivingPlayer);
 	receivingPlayerData->tempData->core->duelOffersReceived[player.getID()]
 		= tempDuelSettings;
 	receivingPlayerExt->sendModeMessage(Mode::Duel,
@@ -255,46 +250,8 @@ void DuelController::showDuelStatsDialog(IPlayer& player, unsigned int id)
 {
 	auto anotherPlayer = this->playerPool->get(id);
 	auto playerData = Core::Player::getPlayerData(*anotherPlayer);
-	auto body = __("#WHITE#- Player:\t\t\t\t\t%s (%d)\n"
-				   "- Score:\t\t\t\t\t\t%d\n"
-				   "- Highest kill streak:\t\t\t\t%d\n"
-				   "- Total kills:\t\t\t\t\t%d\n"
-				   "- Total deaths:\t\t\t\t\t%d\n"
-				   "- Ratio:\t\t\t\t\t\t%.2f\n"
-				   "- Hand kills:\t\t\t\t\t%d\n"
-				   "- Handheld weapon kills:\t\t\t%d\n"
-				   "- Melee kills:\t\t\t\t\t%d\n"
-				   "- Handgun kills:\t\t\t\t\t%d\n"
-				   "- Shotgun kills:\t\t\t\t\t%d\n"
-				   "- SMG kills:\t\t\t\t\t%d\n"
-				   "- Assault rifles kills:\t\t\t\t%d\n"
-				   "- Rifles kills:\t\t\t\t\t%d\n"
-				   "- Heavy weapon kills:\t\t\t\t%d\n"
-				   "- Explosives kills:\t\t\t\t%d");
-	int ratioDeaths = playerData->duelStats->deaths;
-	if (ratioDeaths == 0)
-		ratioDeaths = 1;
-	auto formattedBody = fmt::sprintf(_(body, player),
-		anotherPlayer->getName().to_string(), anotherPlayer->getID(),
-		playerData->duelStats->score, playerData->duelStats->highestKillStreak,
-		playerData->duelStats->kills, playerData->duelStats->deaths,
-		float(playerData->duelStats->kills) / float(ratioDeaths),
-		playerData->duelStats->handKills,
-		playerData->duelStats->handheldWeaponKills,
-		playerData->duelStats->meleeKills, playerData->duelStats->handgunKills,
-		playerData->duelStats->shotgunKills, playerData->duelStats->smgKills,
-		playerData->duelStats->assaultRiflesKills,
-		playerData->duelStats->riflesKills,
-		playerData->duelStats->heavyWeaponKills,
-		playerData->duelStats->explosivesKills);
-
-	auto dialog = std::shared_ptr<Core::MessageDialog>(new Core::MessageDialog(
-		fmt::sprintf(DIALOG_HEADER_TITLE, _("Duel stats", player)),
-		formattedBody, _("OK", player), ""));
-	this->dialogManager->showDialog(player, dialog,
-		[](Core::DialogResult result)
-		{
-		});
+	Modes::showStatsDialog(*this->dialogManager, Core::DialogKind::DuelStats,
+		__("Duel stats"), player, *anotherPlayer, *playerData->duelStats);
 }
 
 void DuelController::showDuelCreationDialog(IPlayer& player)
@@ -358,10 +315,12 @@ void DuelController::showDuelMapSelectionDialog(IPlayer& player)
 	if (!playerData->tempData->core->temporaryDuelSettings)
 		return;
 
-	std::vector<std::string> maps;
+	auto maps
+		= Core::Utils::makeTransientVector<Core::Utils::TransientString>();
+	maps.reserve(ARENAS.size());
 	for (const auto& map : ARENAS)
 	{
-		maps.push_back(map.name);
+		maps.push_back(Core::Utils::makeTransientString(map.name));
 	}
 
 	auto dialog = std::shared_ptr<Core::ListDialog>(new Core::ListDialog(
@@ -428,11 +387,12 @@ void DuelController::showDuelRoundCountSettingDialog(IPlayer& player)
 	auto tempDuelSettings
 		= playerData->tempData->core->temporaryDuelSettings.value();
 
-	std::vector<std::string> items;
-
+	auto items
+		= Core::Utils::makeTransientVector<Core::Utils::TransientString>();
+	items.reserve(15);
 	for (int i = 0; i < 15; i++)
 	{
-		items.push_back(std::to_string(i * 2 + 1));
+		items.push_back(Core::Utils::transientSprintf("%d", i * 2 + 1));
 	}
 
 	auto dialog = std::shared_ptr<Core::ListDialog>(new Core::ListDialog(
@@ -456,17 +416,20 @@ void DuelController::showDuelRoundCountSettingDialog(IPlayer& player)
 void DuelController::showDuelAcceptListDialog(IPlayer& player)
 {
 	std::vector<std::string> duels;
-	std::map<int, int> duelItemToPlayerId;
 
 	auto playerData = Core::Player::getPlayerData(player);
-	int i = 0;
-	for (auto [id, offer] : playerData->tempData->core->duelOffersReceived)
+	auto& acceptList = playerData->tempData->core->duelAcceptList;
+	acceptList.clear();
+	for (const auto& [id, offer] :
+		playerData->tempData->core->duelOffersReceived)
 	{
-		duels.push_back(
-			fmt::sprintf("{%06x}%s(%d)", offer->from->getColour().RGBA() >> 8,
-				offer->from->getName().to_string(), offer->to->getID()));
-		duelItemToPlayerId[i] = id;
-		i++;
+		auto sender = offer->from.get();
+		if (!sender)
+			continue;
+		duels.push_back(fmt::sprintf("{%06x}%s(%d)",
+			sender->getColour().RGBA() >> 8, sender->getName().to_string(),
+			sender->getID()));
+		acceptList.push_back(id);
 	}
 
 	auto playerExt = Core::Player::getPlayerExt(player);
@@ -480,14 +443,15 @@ void DuelController::showDuelAcceptListDialog(IPlayer& player)
 		fmt::sprintf(DIALOG_HEADER_TITLE, _("Duels", player)), duels,
 		_("Accept", player), _("Cancel", player)));
 	this->dialogManager->showDialog(player, dialog,
-		[this, &player, playerData, duelItemToPlayerId](
-			Core::DialogResult result)
+		[this, &player, playerData](Core::DialogResult result)
 		{
 			if (!result.response())
 				return;
 			auto playerExt = Core::Player::getPlayerExt(player);
-			if (result.listItem()
-				>= playerData->tempData->core->duelOffersReceived.size())
+			const auto& acceptList = playerData->tempData->core->duelAcceptList;
+			if (result.listItem() >= acceptList.size()
+				|| !playerData->tempData->core->duelOffersReceived.contains(
+					acceptList[result.listItem()]))
 			{
 				playerExt->sendErrorMessage(
 					__("The player which sent you the duel offer has canceled "
@@ -495,7 +459,7 @@ void DuelController::showDuelAcceptListDialog(IPlayer& player)
 				return;
 			}
 			auto offer = playerData->tempData->core->duelOffersReceived.at(
-				duelItemToPlayerId.at(result.listItem()));
+				acceptList[result.listItem()]);
 			this->showDuelAcceptConfirmDialog(player, offer);
 		});
 }
@@ -504,7 +468,8 @@ void DuelController::showDuelAcceptConfirmDialog(
 	IPlayer& player, std::shared_ptr<DuelOffer> offer)
 {
 	auto playerExt = Core::Player::getPlayerExt(player);
-	if (offer->from->getID() == -1)
+	auto sender = offer->from.get();
+	if (!sender)
 	{
 		playerExt->sendErrorMessage(__("The player has disconnected!"));
 		return;
@@ -518,42 +483,50 @@ void DuelController::showDuelAcceptConfirmDialog(
 			  "%d\n- Starting health: %.1f\n- Starting armour: %.1f\n\nDo you "
 			  "accept the duel?",
 				player),
-			offer->from->getColour().RGBA() >> 8,
-			offer->from->getName().to_string(), offer->from->getID(),
+			sender->getColour().RGBA() >> 8, sender->getName().to_string(),
+			sender->getID(),
 			offer->map.name, offer->weaponSet.toString(player),
 			offer->roundCount, offer->defaultHealth, offer->defaultArmor),
 		_("Accept", player), _("Refuse", player)));
 	this->dialogManager->showDialog(player, dialog,
 		[this, offer, &player](Core::DialogResult result)
 		{
+			// the sender may have left while the dialog was open
+			auto sender = offer->from.get();
+			if (!sender)
+			{
+				auto playerExt = Core::Player::getPlayerExt(player);
+				playerExt->sendErrorMessage(__("The player has disconnected!"));
+				return;
+			}
 			if (!result.response())
 			{
-				this->deleteDuelOfferFromPlayer(*offer->from, true);
-				auto senderExt = Core::Player::getPlayerExt(*offer->from);
+				this->deleteDuelOfferFromPlayer(*sender, true);
+				auto senderExt = Core::Player::getPlayerExt(*sender);
 				senderExt->sendModeMessage(Mode::Duel,
 					__("{%06x}%s(%d) #RED#refused "
 					   "#WHITE#the duel!"),
 					player.getColour().RGBA() >> 8,
-					offer->to->getName().to_string(), offer->to->getID());
+					player.getName().to_string(), player.getID());
 				return;
 			}
 			auto roomId = this->createDuelRoom(offer);
 			offer->tempRoomId = roomId;
 			auto senderJoinResult = this->modeManager.lock()->joinMode(
-				*offer->from, Mode::Duel, { { DUEL_ROOM_ID, roomId } });
+				*sender, Mode::Duel, { { DUEL_ROOM_ID, roomId } });
 			auto receiverJoinResult = this->modeManager.lock()->joinMode(
 				player, Mode::Duel, { { DUEL_ROOM_ID, roomId } });
 			if (!senderJoinResult || !receiverJoinResult)
 			{
-				auto senderExt = Core::Player::getPlayerExt(*offer->from);
-				auto receiverExt = Core::Player::getPlayerExt(*offer->to);
+				auto senderExt = Core::Player::getPlayerExt(*sender);
+				auto receiverExt = Core::Player::getPlayerExt(player);
 				senderExt->sendErrorMessage(
 					__("One of the players cannot join duel, try again!"));
 				receiverExt->sendErrorMessage(
 					__("One of the players cannot join duel, try again!"));
 				return;
 			}
-			this->deleteDuelOfferFromPlayer(*offer->from, false);
+			this->deleteDuelOfferFromPlayer(*sender, false);
 		});
 }
 
@@ -589,7 +562,7 @@ void DuelController::onRoomJoin(IPlayer& player, unsigned int roomId)
 	auto playerExt = Core::Player::getPlayerExt(player);
 
 	playerData->tempData->duel->roomId = roomId;
-	room->players.push_back(&player);
+	room->players.insert(player);
 	player.setHealth(room->defaultHealth);
 	player.setArmour(room->defaultArmor);
 	player.resetWeapons();
@@ -626,19 +599,24 @@ void DuelController::onRoundEnd(
 			std::chrono::system_clock::now() - room->lastRoundStarted.value()),
 		winner->getName().to_string());
 
-	for (auto player : room->players)
+	auto player1 = room->players.at(0);
+	auto player2 = room->players.at(1);
+	if (player1 && player2)
 	{
-		auto playerExt = Core::Player::getPlayerExt(*player);
-		auto playerData1 = Core::Player::getPlayerData(*room->players[0]);
-		auto playerData2 = Core::Player::getPlayerData(*room->players[1]);
-		playerExt->sendModeMessage(
-			__("Results of round %d of %d: %d-%d | time: %s"),
-			room->currentRound + 1, room->maxRounds,
-			playerData1->tempData->duel->kills,
-			playerData2->tempData->duel->kills,
-			std::format("{:%OM:%OS}",
-				std::chrono::system_clock::now()
-					- room->lastRoundStarted.value()));
+		auto playerData1 = Core::Player::getPlayerData(*player1);
+		auto playerData2 = Core::Player::getPlayerData(*player2);
+		for (auto player : room->players)
+		{
+			auto playerExt = Core::Player::getPlayerExt(*player);
+			playerExt->sendModeMessage(
+				__("Results of round %d of %d: %d-%d | time: %s"),
+				room->currentRound + 1, room->maxRounds,
+				playerData1->tempData->duel->kills,
+				playerData2->tempData->duel->kills,
+				std::format("{:%OM:%OS}",
+					std::chrono::system_clock::now()
+						- room->lastRoundStarted.value()));
+		}
 	}
 
 	auto winnerData = Core::Player::getPlayerData(*winner);
@@ -658,7 +636,10 @@ void DuelController::onRoundEnd(
 
 void DuelController::onDuelEnd(std::shared_ptr<Room> duelRoom)
 {
-	std::vector<Deathmatch::DeathmatchResult> resultArray;
+	// damage is handed over in batches, the results need all of it
+	this->modeManager.lock()->flushDamage();
+	auto resultArray
+		= Core::Utils::makeTransientVector<Deathmatch::DeathmatchResult>();
 	for (auto player : duelRoom->players)
 	{
 		auto playerData = Core::Player::getPlayerData(*player);
@@ -669,17 +650,12 @@ void DuelController::onDuelEnd(std::shared_ptr<Room> duelRoom)
 			.damageInflicted = playerData->tempData->duel->damageInflicted });
 	}
 	std::sort(resultArray.begin(), resultArray.end(),
-		[](Deathmatch::DeathmatchResult x1, Deathmatch::DeathmatchResult x2)
-		{
-			if (x1.kills != x2.kills)
-				return x1.kills > x2.kills;
-			return x1.damageInflicted > x2.damageInflicted;
-		});
+		Deathmatch::ranksHigher);
 
 	std::vector<std::vector<std::string>> results;
 	for (std::size_t i = 0; i < resultArray.size(); i++)
 	{
-		auto playerResult = resultArray.at(i);
+		const auto& playerResult = resultArray[i];
 		results.push_back({ fmt::sprintf("{%06x}%d. %s",
 								playerResult.player->getColour().RGBA() >> 8,
 								i + 1,
@@ -693,7 +669,7 @@ void DuelController::onDuelEnd(std::shared_ptr<Room> duelRoom)
 
 	auto now = std::chrono::system_clock::now();
 	auto fightDuration = now - duelRoom->fightStarted;
-	this->bus->fire_event(
+	this->bus->fire(
 		Core::Utils::Events::DuelWin { .winner = *resultArray[0].player,
 			.loser = *resultArray[1].player,
 			.fightDuration
@@ -712,19 +688,19 @@ void DuelController::deleteDuelOfferFromPlayer(IPlayer& player, bool deleteRoom)
 		{
 			this->deleteDuel(offer->tempRoomId.value());
 		}
-		auto receivingPlayerData = Core::Player::getPlayerData(*offer->to);
-		auto senderExt = Core::Player::getPlayerExt(player);
-		receivingPlayerData->tempData->core->duelOffersReceived.erase(
-			player.getID());
+		if (auto receivingPlayer = offer->to.get())
+		{
+			auto receivingPlayerData
+				= Core::Player::getPlayerData(*receivingPlayer);
+			receivingPlayerData->tempData->core->duelOffersReceived.erase(
+				player.getID());
+		}
 		senderData->tempData->core->duelOfferSent = {};
 	}
 }
 
 void DuelController::onPlayerSpawn(IPlayer& player)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Modes::Mode::Duel))
-		return;
 	auto pData = Core::Player::getPlayerData(player);
 	if (pData->tempData->duel->duelEnd)
 	{
@@ -745,14 +721,17 @@ void DuelController::onPlayerSpawn(IPlayer& player)
 			room->lastWinner.value()->spawn();
 		}
 		auto startSecs = std::make_shared<unsigned int>(3);
-		for (auto player : room->players)
+		auto player1 = room->players.at(0);
+		auto player2 = room->players.at(1);
+		// the opponent may have left between the rounds
+		if (player1 && player2)
 		{
-			player->sendGameText(
-				fmt::sprintf("~r~DUEL~n~~w~%s~n~~r~VS.~n~~w~%s~n~Round %d/%d",
-					room->players[0]->getName().to_string(),
-					room->players[1]->getName().to_string(),
-					room->currentRound + 1, room->maxRounds),
-				Seconds(4), 3);
+			auto text = fmt::sprintf(
+				"~r~DUEL~n~~w~%s~n~~r~VS.~n~~w~%s~n~Round %d/%d",
+				player1->getName().to_string(), player2->getName().to_string(),
+				room->currentRound + 1, room->maxRounds);
+			for (auto player : room->players)
+				player->sendGameText(text, Seconds(4), 3);
 		}
 		room->roundStartTimer = this->timersComponent->create(
 			new Impl::SimpleTimerHandler(
@@ -766,8 +745,9 @@ void DuelController::onPlayerSpawn(IPlayer& player)
 						{
 							player->sendGameText("~g~"
 									+ _(fmt::sprintf("%s",
-											ROUND_START_TEXT[rand()
-												% ROUND_START_TEXT.size()]),
+											ROUND_START_TEXT
+												[Core::Utils::randomIndex(
+													ROUND_START_TEXT.size())]),
 										*player),
 								Seconds(1), 3);
 							player->setControllable(true);
@@ -795,9 +775,6 @@ void DuelController::onPlayerSpawn(IPlayer& player)
 
 void DuelController::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Mode::Duel))
-		return;
 	auto playerData = Core::Player::getPlayerData(player);
 	auto room = this->rooms.at(playerData->tempData->duel->roomId);
 	if (room->players.size() < 2)
@@ -828,16 +805,34 @@ void DuelController::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
 	this->onRoundEnd(winner, loser, room, reason);
 }
 
-void DuelController::onPlayerGiveDamage(IPlayer& player, IPlayer& to,
-	float amount, unsigned int weapon, BodyPart part)
+void DuelController::onPlayerKeyStateChange(
+	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	auto playerData = playerExt->getPlayerData();
-	if (!playerExt->isInMode(Modes::Mode::Duel))
+	if (player.getState() != PlayerState_OnFoot)
 		return;
+	auto playerData = Core::Player::getPlayerData(player);
+	auto room = this->rooms.find(playerData->tempData->duel->roomId);
+	if (room == this->rooms.end() || room->second->cbugEnabled)
+		return;
+	this->cbugDetector->onKeyStateChange(player, newKeys, oldKeys);
+}
+
+void DuelController::onDamageFlush(IPlayer& player, float amount)
+{
+	auto playerData = Core::Player::getPlayerData(player);
 	playerData->tempData->duel->damageInflicted += amount;
 }
 
+const Core::Player::PlayerSet* DuelController::getRoomPlayers(IPlayer& player)
+{
+	auto playerData = Core::Player::getPlayerData(player);
+	auto room = this->rooms.find(playerData->tempData->duel->roomId);
+	if (room == this->rooms.end()
+		|| !room->second->players.contains(player))
+		return nullptr;
+	return &room->second->players;
+}
+
 void DuelController::onPlayerDisconnect(
 	IPlayer& player, PeerDisconnectReason reason)
 {
@@ -848,8 +843,11 @@ void DuelController::onPlayerDisconnect(
 		{
 			this->deleteDuel(offer->tempRoomId.value(), &player);
 		}
-		auto senderData = Core::Player::getPlayerData(*offer->from);
-		auto senderExt = Core::Player::getPlayerExt(*offer->from);
+		auto sender = offer->from.get();
+		if (!sender)
+			continue;
+		auto senderData = Core::Player::getPlayerData(*sender);
+		auto senderExt = Core::Player::getPlayerExt(*sender);
 		senderExt->sendModeMessage(Mode::Duel,
 			__("{%06x}%s(%d) #WHITE#declined an offer: "
 			   "disconnected from the server!"),
@@ -866,8 +864,10 @@ void DuelController::onPlayerDisconnect(
 DuelController::DuelController(std::weak_ptr<Core::ModeManager> modeManager,
 	std::shared_ptr<Core::Commands::CommandManager> commandManager,
 	std::shared_ptr<Core::DialogManager> dialogManager, IPlayerPool* playerPool,
-	ITimersComponent* timersComponent, std::shared_ptr<dp::event_bus> bus,
-	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool)
+	ITimersComponent* timersComponent,
+	std::shared_ptr<Core::Utils::EventBus> bus,
+	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool,
+	std::shared_ptr<CbugDetector> cbugDetector)
 	: super(Mode::Duel, bus, playerPool)
 	, roomIdPool(std::make_unique<Core::Utils::IDPool>())
 	, modeManager(modeManager)
@@ -876,31 +876,17 @@ DuelController::DuelController(std::weak_ptr<Core::ModeManager> modeManager,
 	, playerPool(playerPool)
 	, timersComponent(timersComponent)
 	, virtualWorldIdPool(virtualWorldIdPool)
+	, cbugDetector(cbugDetector)
 {
-	this->playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
-	this->playerPool->getPlayerDamageDispatcher().addEventHandler(this);
 	this->playerPool->getPlayerConnectDispatcher().addEventHandler(
 		this, EventPriority_Highest);
 
-	// re-register PoF event subscription
-	this->playerOnFireEventRegistration
-		= this->hookEvent<Core::Utils::Events::PlayerOnFireEvent>(
-			this->playerOnFireEventRegistration, this,
-			&DuelController::onPlayerOnFire);
-
-	// re-register PoF been killed event subscription
-	this->playerOnFireBeenKilledRegistration
-		= this->hookEvent<Core::Utils::Events::PlayerOnFireBeenKilled>(
-			this->playerOnFireBeenKilledRegistration, this,
-			&DuelController::onPlayerOnFireBeenKilled);
-
 	this->initCommands();
 }
 
 DuelController::~DuelController()
 {
-	this->playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
-	this->playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
+	this->playerPool->getPlayerConnectDispatcher().removeEventHandler(this);
 }
 
 void DuelController::initCommands()
@@ -989,11 +975,8 @@ void DuelController::onModeLeave(IPlayer& player)
 	if (this->rooms.contains(roomId))
 	{
 		auto room = this->rooms.at(roomId);
-		std::erase_if(room->players,
-			[&player](IPlayer* x)
-			{
-				return x->getID() == player.getID();
-			});
+		room->players.erase(player);
+		this->cbugDetector->reset(player);
 		this->deleteDuel(roomId, &player);
 		pData->tempData->duel.reset();
 	}
@@ -1002,7 +985,7 @@ void DuelController::onModeLeave(IPlayer& player)
 }
 
 void DuelController::onPlayerOnFire(
-	Core::Utils::Events::PlayerOnFireEvent event)
+	const Core::Utils::Events::PlayerOnFireEvent& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -1012,7 +995,7 @@ void DuelController::onPlayerOnFire(
 }
 
 void DuelController::onPlayerOnFireBeenKilled(
-	Core::Utils::Events::PlayerOnFireBeenKilled event)
+	const Core::Utils::Events::PlayerOnFireBeenKilled& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -1025,24 +1008,21 @@ void DuelController::onPlayerOnFireBeenKilled(
 }
 
 void DuelController::onPlayerLoad(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	auto result = txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(
-				Core::Utils::SQL::Queries::LOAD_DUEL_STATS_FOR_PLAYER)
-			.value(),
+	batch.exec_prepared_then(
+		Core::Utils::SQL::Queries::LOAD_DUEL_STATS_FOR_PLAYER,
+		[data](const pqxx::result& result)
+		{
+			data->duelStats->updateFromRow(result[0]);
+		},
 		data->userId);
-	data->duelStats->updateFromRow(result[0]);
 }
 
 void DuelController::onPlayerSave(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(Core::Utils::SQL::Queries::UPDATE_DUEL_STATS)
-			.value(),
+	batch.exec_prepared(Core::Utils::SQL::Queries::UPDATE_DUEL_STATS,
 		data->duelStats->score, data->duelStats->highestKillStreak,
 		data->duelStats->kills, data->duelStats->deaths,
 		data->x1Stats->handKills, data->duelStats->handheldWeaponKills,
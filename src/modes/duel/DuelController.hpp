@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../CbugDetector.hpp"
 #include "../ModeBase.hpp"
 #include "../../core/ModeManager.hpp"
 #include "../../core/commands/CommandManager.hpp"
@@ -31,9 +32,7 @@ inline const std::array<std::string, 21> ROUND_START_TEXT
 		  __("Smash him!"), __("Smoke him!"), __("RAGE!"), __("NO MERCY!"),
 		  __("ITS WAR!"), __("PUMP HIM!"), __("Show him who's boss!") };
 
-class DuelController : public ModeBase,
-					   public PlayerSpawnEventHandler,
-					   public PlayerConnectEventHandler
+class DuelController : public ModeBase, public PlayerConnectEventHandler
 {
 	void initCommands();
 	void setSpawnPoint(
@@ -73,32 +72,37 @@ class DuelController : public ModeBase,
 	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool;
 	IPlayerPool* playerPool;
 	ITimersComponent* timersComponent;
+	std::shared_ptr<CbugDetector> cbugDetector;
 
 public:
 	DuelController(std::weak_ptr<Core::ModeManager> modeManager,
 		std::shared_ptr<Core::Commands::CommandManager> commandManager,
 		std::shared_ptr<Core::DialogManager> dialogManager,
 		IPlayerPool* playerPool, ITimersComponent* timersComponent,
-		std::shared_ptr<dp::event_bus> bus,
-		std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool);
+		std::shared_ptr<Core::Utils::EventBus> bus,
+		std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool,
+		std::shared_ptr<CbugDetector> cbugDetector);
 	virtual ~DuelController();
 
 	void onPlayerSpawn(IPlayer& player) override;
 	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
-	void onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
-		unsigned int weapon, BodyPart part) override;
+	void onPlayerKeyStateChange(
+		IPlayer& player, uint32_t newKeys, uint32_t oldKeys) override;
+	void onDamageFlush(IPlayer& player, float amount) override;
+	const Core::Player::PlayerSet* getRoomPlayers(IPlayer& player) override;
 	void onPlayerDisconnect(
 		IPlayer& player, PeerDisconnectReason reason) override;
 
 	void onModeSelect(IPlayer& player) override;
 	void onModeJoin(IPlayer& player, JoinData joinData) override;
 	void onModeLeave(IPlayer& player) override;
-	void onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event) override;
+	void onPlayerOnFire(
+		const Core::Utils::Events::PlayerOnFireEvent& event) override;
 	void onPlayerOnFireBeenKilled(
-		Core::Utils::Events::PlayerOnFireBeenKilled event) override;
-	void onPlayerLoad(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
-	void onPlayerSave(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
+		const Core::Utils::Events::PlayerOnFireBeenKilled& event) override;
+	void onPlayerLoad(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
+	void onPlayerSave(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
 };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "../deathmatch/Maps.hpp"
 #include "../deathmatch/WeaponSet.hpp"
+#include "../../core/player/PlayerHandle.hpp"
 
 #include <optional>
 #include <player.hpp>
@@ -18,8 +19,8 @@ struct DuelOffer
 	unsigned int roundCount;
 	float defaultHealth;
 	float defaultArmor;
-	IPlayer* from;
-	IPlayer* to;
+	Core::Player::PlayerHandle from;
+	Core::Player::PlayerHandle to;
 	std::optional<unsigned int> tempRoomId;
 };
 }
\ No newline at end of file
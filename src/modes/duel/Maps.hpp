@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../deathmatch/Maps.hpp"
+#include "../../core/utils/Random.hpp"
+
 #include <vector>
 
 namespace Modes::Duel
@@ -133,10 +135,6 @@ inline const std::vector<Deathmatch::Map> ARENAS = {
 
 inline const Deathmatch::Map randomMap(const std::vector<Deathmatch::Map>& maps)
 {
-	std::random_device rd;
-	std::mt19937 gen(rd());
-
-	std::uniform_int_distribution<> dis(0, maps.size() - 1);
-	return maps.at(dis(rd));
+	return maps.at(Core::Utils::randomIndex(maps.size()));
 };
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "../deathmatch/Maps.hpp"
+#include "../../core/player/PlayerSet.hpp"
+#include "../SpawnLoadout.hpp"
 #include "Server/Components/Timers/timers.hpp"
 
 #include <chrono>
@@ -19,8 +21,8 @@ struct Room
 	/// Allowed weapons in the room
 	std::array<PlayerWeapon, MAX_WEAPON_SLOTS> allowedWeapons;
 
-	/// A list of players which joined the room.
-	std::vector<IPlayer*> players;
+	/// Players which joined the room, in the order they joined
+	Core::Player::PlayerSet players;
 
 	/// Room virtual world
 	unsigned int virtualWorld;
@@ -35,6 +37,9 @@ struct Room
 
 	float defaultArmor = 0.0;
 
+	/// Whether C-bug is allowed in the room
+	bool cbugEnabled = true;
+
 	std::chrono::time_point<std::chrono::system_clock> fightStarted;
 	std::optional<std::chrono::time_point<std::chrono::system_clock>>
 		lastRoundStarted;
@@ -47,6 +52,9 @@ struct Room
 
 	std::optional<std::vector<std::vector<std::string>>> cachedResults;
 
+	/// Spawn weapons, rebuilt from allowedWeapons when the room is set up
+	SpawnLoadout loadout;
+
 	template <typename... T>
 	void sendMessageToAll(const std::string& message, T&&... args);
 };
@@ -1,9 +1,10 @@
 #include "FreeroamController.hpp"
 #include "../../core/player/PlayerExtension.hpp"
+#include "../../core/utils/Random.hpp"
+#include "../../core/utils/TickArena.hpp"
 #include "../../core/utils/VehicleList.hpp"
 #include "FreeroamVehicles.hpp"
 #include "component.hpp"
-#include "eventbus/event_bus.hpp"
 #include "types.hpp"
 
 #include <cstdlib>
@@ -12,7 +13,9 @@
 #include <player.hpp>
 #include <Server/Components/Vehicles/vehicles.hpp>
 #include <Server/Components/Classes/classes.hpp>
+#include <Server/Components/Timers/Impl/timers_impl.hpp>
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <scn/scan.h>
@@ -28,35 +31,36 @@ FreeroamController::FreeroamController(IComponentList* components,
 	std::weak_ptr<Core::ModeManager> modeManager,
 	std::shared_ptr<Core::DialogManager> dialogManager,
 	std::shared_ptr<Core::Commands::CommandManager> commandManager,
-	std::shared_ptr<dp::event_bus> bus)
+	std::shared_ptr<Core::Utils::EventBus> bus,
+	std::shared_ptr<Core::StartupScheduler> startupScheduler,
+	std::shared_ptr<Core::RateLimiter> rateLimiter)
 	: super(Mode::Freeroam, bus, playerPool)
 	, modeManager(modeManager)
 	, vehiclesComponent(components->queryComponent<IVehiclesComponent>())
 	, playerPool(playerPool)
 	, dialogManager(dialogManager)
 	, commandManager(commandManager)
+	, rateLimiter(rateLimiter)
 	, virtualWorldId(virtualWorldIdPool->allocateId())
 {
-	playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
-	playerPool->getPlayerDamageDispatcher().addEventHandler(this);
+	vehiclesComponent->getEventDispatcher().addEventHandler(this);
+	this->vehicleIndexTimer
+		= components->queryComponent<ITimersComponent>()->create(
+			new Impl::SimpleTimerHandler(
+				[this]()
+				{
+					this->refreshDrivenVehicles();
+				}),
+			VEHICLE_INDEX_INTERVAL, true);
 
 	this->initCommands();
-	this->initVehicles();
+	this->initVehicles(*startupScheduler);
 }
 
 FreeroamController::~FreeroamController()
 {
-	playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
-	playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
-}
-
-void FreeroamController::onPlayerSpawn(IPlayer& player)
-{
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Mode::Freeroam))
-	{
-		return;
-	}
+	this->vehicleIndexTimer->kill();
+	vehiclesComponent->getEventDispatcher().removeEventHandler(this);
 }
 
 void FreeroamController::onModeJoin(IPlayer& player,
@@ -93,7 +97,7 @@ void FreeroamController::initCommands()
 			auto [modelId, color1, color2] = result->values();
 
 			auto playerExt = Core::Player::getPlayerExt(player);
-			if (!playerExt->isInMode(Mode::Freeroam))
+			if (!this->players.contains(player))
 			{
 				playerExt->sendErrorMessage(
 					__("You can spawn vehicles only in Freeroam mode!"));
@@ -119,9 +123,10 @@ void FreeroamController::initCommands()
 			auto playerPosition = player.get().getPosition();
 			auto vehicle = vehiclesComponent->create(false, modelId,
 				playerPosition, 0.0, color1, color2, Seconds(60000));
+			this->indexVehicle(*vehicle);
 			vehicle->putPlayer(player, 0);
 			playerExt->sendInfoMessage(
-				_("You have sucessfully spawned the vehicle!", player));
+				__("You have sucessfully spawned the vehicle!"));
 			playerExt->getPlayerData()->tempData->freeroam->lastVehicleId
 				= vehicle->getID();
 
@@ -139,7 +144,7 @@ void FreeroamController::initCommands()
 				return false;
 
 			auto playerExt = Core::Player::getPlayerExt(player);
-			if (!playerExt->isInMode(Mode::Freeroam))
+			if (!this->players.contains(player))
 			{
 				playerExt->sendErrorMessage(
 					__("You can spawn vehicles only in Freeroam mode!"));
@@ -186,8 +191,8 @@ void FreeroamController::initCommands()
 			player.get().setSkin(skinId);
 			auto data = Core::Player::getPlayerData(player.get());
 			data->lastSkinId = skinId;
-			playerExt->sendInfoMessage(fmt::sprintf(
-				_("You have changed your skin to ID: %d!", player), skinId));
+			playerExt->sendInfoMessage(
+				__("You have changed your skin to ID: %d!"), skinId);
 			return true;
 		},
 		Core::Commands::CommandInfo {
@@ -202,6 +207,9 @@ void FreeroamController::initCommands()
 			if (!result)
 				return false;
 			auto [recipientId, message] = result->values();
+			if (!this->rateLimiter->consume(
+					player, Core::RateCategory::PrivateMessage))
+				return true;
 			auto recipient = this->playerPool->get(recipientId);
 			auto senderExt = Core::Player::getPlayerExt(player);
 			if (!Core::Player::getPlayerData(player)->settings->pmsEnabled) {
@@ -247,40 +255,49 @@ void FreeroamController::initCommands()
 		});
 }
 
-void FreeroamController::initVehicles()
+void FreeroamController::initVehicles(Core::StartupScheduler& startupScheduler)
 {
-	std::vector<std::vector<Vehicle>> vehiclesList
-		= { GEN_LS_INNER, GEN_LS_OUTER, LS_LAW, LS_AIRPORT, BONE, FLINT,
-			  LV_AIRPORT, LV_GEN, LV_LAW, PILOTS, RED_COUNTY, SF_AIRPORT,
-			  SF_GEN, SF_LAW, SF_TRAIN, TIERRA, TRAINS, WHETSTONE };
-	for (auto list : vehiclesList)
-	{
-		for (auto v : list)
+	std::size_t total = 0;
+	for (const auto& table : VEHICLE_TABLES)
+		total += table.size();
+
+	// Spread vehicle creation over several ticks instead of spawning the
+	// whole set in one go
+	startupScheduler.runSliced("freeroam vehicles", total,
+		VEHICLE_SPAWN_BATCH_SIZE,
+		[this](std::size_t)
 		{
-			auto vehicle = this->vehiclesComponent->create(VehicleSpawnData {
-				.respawnDelay = Minutes(30),
-				.modelID = v.vehicleType,
-				.position = Vector3(v.position.x, v.position.y, v.position.z),
-				.zRotation = v.position.w,
-				.colour1 = v.color1,
-				.colour2 = v.color2,
-
-			});
-			vehicle->setVirtualWorld(this->virtualWorldId);
-			vehicle->setPlate(
-				fmt::sprintf("oasis{44AA33}%d", vehicle->getID()));
-		}
+			this->spawnNextVehicle();
+		});
+}
+
+void FreeroamController::spawnNextVehicle()
+{
+	while (this->spawnVehicleIndex
+		>= VEHICLE_TABLES[this->spawnTableIndex].size())
+	{
+		this->spawnTableIndex++;
+		this->spawnVehicleIndex = 0;
 	}
+
+	const auto& v
+		= VEHICLE_TABLES[this->spawnTableIndex][this->spawnVehicleIndex++];
+	auto vehicle = this->vehiclesComponent->create(VehicleSpawnData {
+		.respawnDelay = Minutes(30),
+		.modelID = v.vehicleType,
+		.position = Vector3(v.position.x, v.position.y, v.position.z),
+		.zRotation = v.position.angle,
+		.colour1 = v.color1,
+		.colour2 = v.color2,
+	});
+	vehicle->setVirtualWorld(this->virtualWorldId);
+	vehicle->setPlate(fmt::sprintf("oasis{44AA33}%d", vehicle->getID()));
+	this->indexVehicle(*vehicle);
 }
 
 void FreeroamController::onPlayerDeath(
 	IPlayer& player, IPlayer* killer, int reason)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Mode::Freeroam))
-	{
-		return;
-	}
 	setupSpawn(player);
 }
 
@@ -307,13 +324,13 @@ void FreeroamController::onModeSelect(IPlayer& player)
 }
 
 void FreeroamController::onPlayerSave(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
 	// TODO
 }
 
 void FreeroamController::onPlayerLoad(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
 	// TODO
 }
@@ -324,91 +341,82 @@ void FreeroamController::deleteLastSpawnedCar(IPlayer& player)
 	if (auto lastVehicleId = playerData->tempData->freeroam->lastVehicleId)
 	{
 		auto vehicle = vehiclesComponent->get(lastVehicleId.value());
+		this->vehicleIndex.remove(lastVehicleId.value());
 		vehiclesComponent->release(lastVehicleId.value());
 		playerData->tempData->freeroam->lastVehicleId.reset();
 	}
 }
 
+void FreeroamController::indexVehicle(IVehicle& vehicle)
+{
+	this->vehicleIndex.insert(vehicle.getID(), vehicle.getPosition());
+}
+
+void FreeroamController::onVehicleSpawn(IVehicle& vehicle)
+{
+	if (this->vehicleIndex.contains(vehicle.getID()))
+		this->indexVehicle(vehicle);
+}
+
+void FreeroamController::onPlayerExitVehicle(
+	IPlayer& player, IVehicle& vehicle)
+{
+	if (this->vehicleIndex.contains(vehicle.getID()))
+		this->indexVehicle(vehicle);
+}
+
+bool FreeroamController::onUnoccupiedVehicleUpdate(IVehicle& vehicle,
+	IPlayer& player, UnoccupiedVehicleUpdate const updateData)
+{
+	if (this->vehicleIndex.contains(vehicle.getID()))
+		this->vehicleIndex.update(vehicle.getID(), updateData.position);
+	return true;
+}
+
+void FreeroamController::refreshDrivenVehicles()
+{
+	for (auto player : this->getPlayers())
+	{
+		if (player->getState() != PlayerState_Driver)
+			continue;
+		auto vehicleData = queryExtension<IPlayerVehicleData>(*player);
+		auto vehicle = vehicleData ? vehicleData->getVehicle() : nullptr;
+		if (vehicle && this->vehicleIndex.contains(vehicle->getID()))
+			this->vehicleIndex.update(
+				vehicle->getID(), vehicle->getPosition());
+	}
+}
+
 void FreeroamController::showVehicleSpawningDialog(IPlayer& player)
 {
-	std::vector<std::vector<std::string>> items = {
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 1, _("Aircraft", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Aircraft)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 2, _("Helicopter", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::Helicopter)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 3, _("Bike", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Bike)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 4, _("Convertible", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::Convertible)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 5, _("Industrial", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::Industrial)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 6, _("Lowrider", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Lowrider)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 7, _("Off Road", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::OffRoad)
-					.size()) },
-		{ fmt::sprintf(
-			  "{999999}%d. {FFFFFF}%s", 8, _("Public Service", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::PublicService)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 9, _("Saloon", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Saloon)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 10, _("Sport", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::SportsCar)
-					.size()) },
-		{ fmt::sprintf(
-			  "{999999}%d. {FFFFFF}%s", 11, _("Station Wagon", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST
-					.at(Core::Utils::VehicleType::StationWagon)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 12, _("Boat", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Boat)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 13, _("Trailer", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Trailer)
-					.size()) },
-		{ fmt::sprintf(
-			  "{999999}%d. {FFFFFF}%s", 14, _("Unique Vehicle", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::Unique)
-					.size()) },
-		{ fmt::sprintf("{999999}%d. {FFFFFF}%s", 15, _("RC Vehicle", player)),
-			fmt::sprintf("{999999}%d",
-				Core::Utils::VEHICLE_LIST.at(Core::Utils::VehicleType::RC)
-					.size()) }
-	};
+	auto buildDialog = [&player]()
+	{
+		// same order as Core::Utils::VehicleType
+		static const std::array VEHICLE_TYPE_NAMES = { __("Aircraft"),
+			__("Helicopter"), __("Bike"), __("Convertible"), __("Industrial"),
+			__("Lowrider"), __("Off Road"), __("Public Service"),
+			__("Saloon"), __("Sport"), __("Station Wagon"), __("Boat"),
+			__("Trailer"), __("Unique Vehicle"), __("RC Vehicle") };
+
+		std::vector<std::vector<std::string>> items;
+		for (auto type : magic_enum::enum_values<Core::Utils::VehicleType>())
+		{
+			auto index = magic_enum::enum_integer(type);
+			items.push_back({ fmt::sprintf("{999999}%d. {FFFFFF}%s",
+								  index + 1,
+								  _(VEHICLE_TYPE_NAMES[index], player)),
+				fmt::sprintf(
+					"{999999}%d", Core::Utils::VEHICLE_LIST.at(type).size()) });
+		}
 
-	auto dialog = std::shared_ptr<Core::TabListHeadersDialog>(
-		new Core::TabListHeadersDialog(
+		return std::shared_ptr<Core::IDialog>(new Core::TabListHeadersDialog(
 			fmt::sprintf(DIALOG_HEADER_TITLE, _("Select vehicle type", player)),
 			{ _("Vehicle type", player), _("Total vehicles", player) }, items,
 			_("Select", player), _("Cancel", player)));
-	this->dialogManager->showDialog(player, dialog,
+	};
+
+	this->dialogManager->showDialog(player, Core::DialogKind::VehicleSpawning,
+		buildDialog, {},
 		[this, &player](Core::DialogResult result)
 		{
 			if (!result.response())
@@ -422,13 +430,17 @@ void FreeroamController::showVehicleSpawningDialog(IPlayer& player)
 void FreeroamController::showVehicleListDialog(
 	IPlayer& player, Core::Utils::VehicleType vehicleTypeSelected)
 {
-	std::vector<std::vector<std::string>> items;
+	using Core::Utils::transientSprintf;
+	const auto& vehicles = Core::Utils::VEHICLE_LIST.at(vehicleTypeSelected);
+	auto items = Core::Utils::makeTransientVector<Core::TransientRow>();
+	items.reserve(vehicles.size());
 
 	int i = 1;
-	for (auto v : Core::Utils::VEHICLE_LIST.at(vehicleTypeSelected))
+	for (const auto& v : vehicles)
 	{
-		items.push_back({ fmt::sprintf("{999999}%d. {FFFFFF}%s", i, v.name),
-			fmt::sprintf("{999999}%d", v.modelId) });
+		auto& row = items.emplace_back();
+		row.push_back(transientSprintf("{999999}%d. {FFFFFF}%s", i, v.name));
+		row.push_back(transientSprintf("{999999}%d", v.modelId));
 		i++;
 	}
 
@@ -454,11 +466,13 @@ void FreeroamController::showVehicleListDialog(
 					Core::Utils::VEHICLE_LIST
 						.at(vehicleTypeSelected)[result.listItem()]
 						.modelId,
-					playerPosition, 0.0, std::rand() % 128, std::rand() % 128,
+					playerPosition, 0.0, Core::Utils::randomInt(0, 127),
+					Core::Utils::randomInt(0, 127),
 					Seconds(60000));
+				this->indexVehicle(*vehicle);
 				vehicle->putPlayer(player, 0);
 				playerExt->sendInfoMessage(
-					_("You have sucessfully spawned the vehicle!", player));
+					__("You have sucessfully spawned the vehicle!"));
 				playerExt->getPlayerData()->tempData->freeroam->lastVehicleId
 					= vehicle->getID();
 			}
@@ -5,16 +5,22 @@
 #include "../../core/dialogs/DialogManager.hpp"
 #include "../../core/commands/CommandManager.hpp"
 #include "../../core/ModeManager.hpp"
+#include "../../core/RateLimiter.hpp"
+#include "../../core/StartupScheduler.hpp"
 #include "../../core/utils/IDPool.hpp"
+#include "../../core/utils/SpatialGrid.hpp"
 #include "component.hpp"
 
 #include <types.hpp>
+#include <Server/Components/Timers/timers.hpp>
 #include <Server/Components/Vehicles/vehicle_components.hpp>
+#include <Server/Components/Vehicles/vehicles.hpp>
 #include <player.hpp>
 
 #include <memory>
 #include <string>
 #include <functional>
+#include <vector>
 
 namespace Modes::Freeroam
 {
@@ -22,9 +28,13 @@ inline const std::string MODE_NAME = "freeroam";
 
 inline const auto SPAWN_LOCATION = Vector3(2037.4828, -1193.1844, 22.7924);
 inline const auto SPAWN_ANGLE = 99.7903;
+inline const std::size_t VEHICLE_SPAWN_BATCH_SIZE = 64;
+/// position events only arrive for unoccupied vehicles, driven ones are
+/// moved in the index on this interval
+inline const auto VEHICLE_INDEX_INTERVAL = Milliseconds(1000);
 
 class FreeroamController : public Modes::ModeBase,
-						   public PlayerSpawnEventHandler
+						   public VehicleEventHandler
 {
 	IPlayerPool* playerPool;
 	IVehiclesComponent* vehiclesComponent;
@@ -32,12 +42,21 @@ class FreeroamController : public Modes::ModeBase,
 	std::weak_ptr<Core::ModeManager> modeManager;
 	std::shared_ptr<Core::DialogManager> dialogManager;
 	std::shared_ptr<Core::Commands::CommandManager> commandManager;
+	std::shared_ptr<Core::RateLimiter> rateLimiter;
 	unsigned int virtualWorldId;
+	Core::Utils::SpatialGrid<int> vehicleIndex;
+	ITimer* vehicleIndexTimer = nullptr;
+
+	std::size_t spawnTableIndex = 0;
+	std::size_t spawnVehicleIndex = 0;
 
 	void initCommands();
-	void initVehicles();
+	void initVehicles(Core::StartupScheduler& startupScheduler);
+	void spawnNextVehicle();
 	void setupSpawn(IPlayer& player);
 	void deleteLastSpawnedCar(IPlayer& player);
+	void indexVehicle(IVehicle& vehicle);
+	void refreshDrivenVehicles();
 
 	void showVehicleSpawningDialog(IPlayer& player);
 	void showVehicleListDialog(
@@ -49,7 +68,9 @@ public:
 		std::weak_ptr<Core::ModeManager> modeManager,
 		std::shared_ptr<Core::DialogManager> dialogManager,
 		std::shared_ptr<Core::Commands::CommandManager> commandManager,
-		std::shared_ptr<dp::event_bus> bus);
+		std::shared_ptr<Core::Utils::EventBus> bus,
+		std::shared_ptr<Core::StartupScheduler> startupScheduler,
+		std::shared_ptr<Core::RateLimiter> rateLimiter);
 	virtual ~FreeroamController();
 
 	void onModeJoin(IPlayer& player,
@@ -57,12 +78,29 @@ public:
 	void onModeLeave(IPlayer& player) override;
 	void onModeSelect(IPlayer& player) override;
 
-	void onPlayerSave(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
-	void onPlayerLoad(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
+	/// Ids of the freeroam vehicles within radius, from an index that may
+	/// be up to VEHICLE_INDEX_INTERVAL old for driven vehicles
+	std::vector<int> vehiclesInRadius(const Vector3& position, float radius)
+	{
+		return this->vehicleIndex.queryRadius(position, radius);
+	}
+	/// Up to count freeroam vehicle ids, nearest first
+	std::vector<int> nearestVehicles(
+		const Vector3& position, std::size_t count, float maxRadius)
+	{
+		return this->vehicleIndex.nearest(position, count, maxRadius);
+	}
+
+	void onPlayerSave(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
+	void onPlayerLoad(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
 
-	void onPlayerSpawn(IPlayer& player) override;
 	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
+
+	void onVehicleSpawn(IVehicle& vehicle) override;
+	void onPlayerExitVehicle(IPlayer& player, IVehicle& vehicle) override;
+	bool onUnoccupiedVehicleUpdate(IVehicle& vehicle, IPlayer& player,
+		UnoccupiedVehicleUpdate const updateData) override;
 };
 }
\ No newline at end of file
@@ -2,10 +2,12 @@
 
 #include "../deathmatch/Maps.hpp"
 #include "../deathmatch/WeaponSet.hpp"
+#include "../../core/player/PlayerSet.hpp"
+#include "../SpawnLoadout.hpp"
+#include "../SpawnSelector.hpp"
 
 #include <chrono>
 #include <player.hpp>
-#include <unordered_set>
 
 namespace Modes::X1
 {
@@ -21,7 +23,7 @@ struct Room
 	Deathmatch::WeaponSet weaponSet;
 
 	/// A list of players which joined the room.
-	std::unordered_set<IPlayer*> players;
+	Core::Player::PlayerSet players;
 
 	/// Room virtual world
 	unsigned int virtualWorld;
@@ -36,8 +38,17 @@ struct Room
 
 	float defaultArmor = 0.0;
 
+	/// Whether C-bug is allowed in the room
+	bool cbugEnabled = true;
+
 	std::chrono::time_point<std::chrono::system_clock> fightStarted;
 
+	/// Picks spawn points away from the other players
+	SpawnSelector spawnSelector;
+
+	/// Spawn weapons, rebuilt from allowedWeapons when the room is set up
+	SpawnLoadout loadout;
+
 	template <typename... T>
 	void sendMessageToAll(const std::string& message, T&&... args);
 };
@@ -1,8 +1,10 @@
 #include "X1Controller.hpp"
+#include "../StatsDialog.hpp"
 #include "../deathmatch/Maps.hpp"
 #include "../../core/player/PlayerExtension.hpp"
 #include "../../core/utils/Common.hpp"
 #include "../../core/utils/QueryNames.hpp"
+#include "../../core/utils/TickArena.hpp"
 #include "../../core/SQLQueryManager.hpp"
 #include "X1PlayerTempData.hpp"
 
@@ -69,31 +71,18 @@ void X1Controller::initRooms()
 void X1Controller::createRoom(std::shared_ptr<Room> room)
 {
 	room->virtualWorld = this->virtualWorldIdPool->allocateId();
+	room->loadout.update(room->allowedWeapons);
 	auto roomId = this->roomIdPool->allocateId();
 	this->rooms[roomId] = room;
+	this->roomsMetric.set(this->rooms.size());
 }
 
 void X1Controller::setRandomSpawnPoint(
 	IPlayer& player, std::shared_ptr<Room> room)
 {
-	std::random_device rd;
-	std::mt19937 gen(rd());
-	std::uniform_int_distribution<> dis(0, room->map.spawnPoints.size() - 1);
-
-	int spawnPointIndex = dis(rd);
-	auto spawnPoint = room->map.spawnPoints[spawnPointIndex];
-	auto classData = queryExtension<IPlayerClassData>(player);
-	std::vector<WeaponSlotData> slotsVector;
-	for (const auto& weapon : room->allowedWeapons)
-	{
-		slotsVector.push_back(WeaponSlotData(weapon, 9999));
-	}
-	WeaponSlots weaponSlots;
-	std::ranges::copy(
-		slotsVector.begin(), slotsVector.end(), weaponSlots.begin());
-	classData->setSpawnInfo(
-		PlayerClass(Core::Player::getPlayerData(player)->lastSkinId, TEAM_NONE,
-			Vector3(spawnPoint), spawnPoint.w, weaponSlots));
+	const auto& spawnPoint = room->spawnSelector.select(
+		room->map.spawnPoints, room->players, player);
+	room->loadout.apply(player, spawnPoint);
 }
 
 void X1Controller::setupRoomForPlayer(
@@ -186,38 +175,40 @@ void X1Controller::logStatsForPlayer(IPlayer& player, bool winner, int weapon)
 
 void X1Controller::showArenaSelectionDialog(IPlayer& player)
 {
-	std::vector<std::vector<std::string>> items;
+	using Core::Utils::transientSprintf;
+	auto items = Core::Utils::makeTransientVector<Core::TransientRow>();
+	items.reserve(this->rooms.size());
 	for (auto [roomId, room] : this->rooms)
 	{
-		std::string playerCount;
+		auto& row = items.emplace_back();
+		row.push_back(transientSprintf(
+			"{999999}%d. {FFFFFF}%s", roomId + 1, room->map.name));
+		row.push_back(
+			transientSprintf("{FFFFFF}%s", room->weaponSet.toString(player)));
 		switch (room->players.size())
 		{
 		case 0:
 		{
-			playerCount = "{FFFFFF}0/2";
+			row.push_back(Core::Utils::makeTransientString("{FFFFFF}0/2"));
 			break;
 		}
 		case 1:
 		{
-			playerCount = "{00FF00}1/2";
+			row.push_back(Core::Utils::makeTransientString("{00FF00}1/2"));
 			break;
 		}
 		case 2:
 		{
-			playerCount = "{FF0000}2/2";
+			row.push_back(Core::Utils::makeTransientString("{FF0000}2/2"));
 			break;
 		}
 		default:
 		{
-			playerCount = fmt::sprintf("{FFFFFF}%d/2", room->players.size());
+			row.push_back(
+				transientSprintf("{FFFFFF}%d/2", room->players.size()));
 			break;
 		}
 		}
-
-		items.push_back({ fmt::sprintf("{999999}%d. {FFFFFF}%s", roomId + 1,
-							  room->map.name),
-			fmt::sprintf("{FFFFFF}%s", room->weaponSet.toString(player)),
-			playerCount });
 	}
 	auto dialog = std::shared_ptr<Core::TabListHeadersDialog>(
 		new Core::TabListHeadersDialog(
@@ -253,45 +244,8 @@ void X1Controller::showX1StatsDialog(IPlayer& player, unsigned int id)
 {
 	auto anotherPlayer = this->playerPool->get(id);
 	auto playerData = Core::Player::getPlayerData(*anotherPlayer);
-	auto body = __("#WHITE#- Player:\t\t\t\t\t%s (%d)\n"
-				   "- Score:\t\t\t\t\t\t%d\n"
-				   "- Highest kill streak:\t\t\t\t%d\n"
-				   "- Total kills:\t\t\t\t\t%d\n"
-				   "- Total deaths:\t\t\t\t\t%d\n"
-				   "- Ratio:\t\t\t\t\t\t%.2f\n"
-				   "- Hand kills:\t\t\t\t\t%d\n"
-				   "- Handheld weapon kills:\t\t\t%d\n"
-				   "- Melee kills:\t\t\t\t\t%d\n"
-				   "- Handgun kills:\t\t\t\t\t%d\n"
-				   "- Shotgun kills:\t\t\t\t\t%d\n"
-				   "- SMG kills:\t\t\t\t\t%d\n"
-				   "- Assault rifles kills:\t\t\t\t%d\n"
-				   "- Rifles kills:\t\t\t\t\t%d\n"
-				   "- Heavy weapon kills:\t\t\t\t%d\n"
-				   "- Explosives kills:\t\t\t\t%d");
-	int ratioDeaths = playerData->x1Stats->deaths;
-	if (ratioDeaths == 0)
-		ratioDeaths = 1;
-	auto formattedBody = fmt::sprintf(_(body, player),
-		anotherPlayer->getName().to_string(), anotherPlayer->getID(),
-		playerData->x1Stats->score, playerData->x1Stats->highestKillStreak,
-		playerData->x1Stats->kills, playerData->x1Stats->deaths,
-		float(playerData->x1Stats->kills) / float(ratioDeaths),
-		playerData->x1Stats->handKills,
-		playerData->x1Stats->handheldWeaponKills,
-		playerData->x1Stats->meleeKills, playerData->x1Stats->handgunKills,
-		playerData->x1Stats->shotgunKills, playerData->x1Stats->smgKills,
-		playerData->x1Stats->assaultRiflesKills,
-		playerData->x1Stats->riflesKills, playerData->x1Stats->heavyWeaponKills,
-		playerData->x1Stats->explosivesKills);
-
-	auto dialog = std::shared_ptr<Core::MessageDialog>(new Core::MessageDialog(
-		fmt::sprintf(DIALOG_HEADER_TITLE, _("X1 stats", player)), formattedBody,
-		_("OK", player), ""));
-	this->dialogManager->showDialog(player, dialog,
-		[](Core::DialogResult result)
-		{
-		});
+	Modes::showStatsDialog(*this->dialogManager, Core::DialogKind::X1Stats,
+		__("X1 stats"), player, *anotherPlayer, *playerData->x1Stats);
 }
 
 void X1Controller::onRoomJoin(IPlayer& player, unsigned int roomId)
@@ -301,7 +255,7 @@ void X1Controller::onRoomJoin(IPlayer& player, unsigned int roomId)
 	auto playerExt = Core::Player::getPlayerExt(player);
 
 	playerData->tempData->x1->roomId = roomId;
-	room->players.emplace(&player);
+	room->players.insert(player);
 	player.setHealth(room->defaultHealth);
 	player.setArmour(room->defaultArmor);
 	player.resetWeapons();
@@ -328,9 +282,6 @@ void X1Controller::onRoomJoin(IPlayer& player, unsigned int roomId)
 
 void X1Controller::onPlayerSpawn(IPlayer& player)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Modes::Mode::X1))
-		return;
 	auto pData = Core::Player::getPlayerData(player);
 	if (pData->tempData->x1->endArena)
 	{
@@ -345,9 +296,6 @@ void X1Controller::onPlayerSpawn(IPlayer& player)
 
 void X1Controller::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
 {
-	auto playerExt = Core::Player::getPlayerExt(player);
-	if (!playerExt->isInMode(Mode::X1))
-		return;
 	auto playerData = Core::Player::getPlayerData(player);
 	auto room = this->rooms.at(playerData->tempData->x1->roomId);
 	if (room->players.size() < 2)
@@ -371,7 +319,7 @@ void X1Controller::onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
 
 	auto loserPos = loser->getPosition();
 	auto winnerPos = winner->getPosition();
-	this->bus->fire_event(Core::Utils::Events::X1ArenaWin { .winner = *winner,
+	this->bus->fire(Core::Utils::Events::X1ArenaWin { .winner = *winner,
 		.loser = *loser,
 		.armourLeft = winner->getArmour(),
 		.healthLeft = winner->getHealth(),
@@ -390,7 +338,9 @@ X1Controller::X1Controller(std::weak_ptr<Core::ModeManager> coreManager,
 	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool,
 	std::shared_ptr<Core::Commands::CommandManager> commandManager,
 	std::shared_ptr<Core::DialogManager> dialogManager, IPlayerPool* playerPool,
-	ITimersComponent* timersComponent, std::shared_ptr<dp::event_bus> bus)
+	ITimersComponent* timersComponent,
+	std::shared_ptr<Core::Utils::EventBus> bus,
+	std::shared_ptr<CbugDetector> cbugDetector)
 	: super(Mode::X1, bus, playerPool)
 	, virtualWorldIdPool(virtualWorldIdPool)
 	, roomIdPool(std::make_unique<Core::Utils::IDPool>())
@@ -399,31 +349,13 @@ X1Controller::X1Controller(std::weak_ptr<Core::ModeManager> coreManager,
 	, dialogManager(dialogManager)
 	, playerPool(playerPool)
 	, timersComponent(timersComponent)
+	, cbugDetector(cbugDetector)
 {
-	this->playerPool->getPlayerSpawnDispatcher().addEventHandler(this);
-	this->playerPool->getPlayerDamageDispatcher().addEventHandler(this);
-
-	// re-register PoF event subscription
-	this->playerOnFireEventRegistration
-		= this->hookEvent<Core::Utils::Events::PlayerOnFireEvent>(
-			this->playerOnFireEventRegistration, this,
-			&X1Controller::onPlayerOnFire);
-
-	// re-register PoF been killed event subscription
-	this->playerOnFireBeenKilledRegistration
-		= this->hookEvent<Core::Utils::Events::PlayerOnFireBeenKilled>(
-			this->playerOnFireBeenKilledRegistration, this,
-			&X1Controller::onPlayerOnFireBeenKilled);
-
 	this->initRooms();
 	this->initCommands();
 }
 
-X1Controller::~X1Controller()
-{
-	this->playerPool->getPlayerSpawnDispatcher().removeEventHandler(this);
-	this->playerPool->getPlayerDamageDispatcher().removeEventHandler(this);
-}
+X1Controller::~X1Controller() { }
 
 void X1Controller::initCommands()
 {
@@ -469,6 +401,28 @@ void X1Controller::initCommands()
 			.category = X1_MODE_NAME });
 }
 
+void X1Controller::onPlayerKeyStateChange(
+	IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
+{
+	if (player.getState() != PlayerState_OnFoot)
+		return;
+	auto playerData = Core::Player::getPlayerData(player);
+	auto room = this->rooms.find(playerData->tempData->x1->roomId);
+	if (room == this->rooms.end() || room->second->cbugEnabled)
+		return;
+	this->cbugDetector->onKeyStateChange(player, newKeys, oldKeys);
+}
+
+const Core::Player::PlayerSet* X1Controller::getRoomPlayers(IPlayer& player)
+{
+	auto playerData = Core::Player::getPlayerData(player);
+	auto room = this->rooms.find(playerData->tempData->x1->roomId);
+	if (room == this->rooms.end()
+		|| !room->second->players.contains(player))
+		return nullptr;
+	return &room->second->players;
+}
+
 void X1Controller::onModeSelect(IPlayer& player)
 {
 	this->showArenaSelectionDialog(player);
@@ -486,12 +440,14 @@ void X1Controller::onModeLeave(IPlayer& player)
 	auto pData = Core::Player::getPlayerData(player);
 	auto roomId = pData->tempData->x1->roomId;
 	auto room = this->rooms.at(roomId);
-	room->players.erase(&player);
+	room->players.erase(player);
+	this->cbugDetector->reset(player);
 
 	super::onModeLeave(player);
 }
 
-void X1Controller::onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event)
+void X1Controller::onPlayerOnFire(
+	const Core::Utils::Events::PlayerOnFireEvent& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -501,7 +457,7 @@ void X1Controller::onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event)
 }
 
 void X1Controller::onPlayerOnFireBeenKilled(
-	Core::Utils::Events::PlayerOnFireBeenKilled event)
+	const Core::Utils::Events::PlayerOnFireBeenKilled& event)
 {
 	if (event.mode != this->mode)
 		return;
@@ -514,24 +470,21 @@ void X1Controller::onPlayerOnFireBeenKilled(
 }
 
 void X1Controller::onPlayerLoad(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	auto result = txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(
-				Core::Utils::SQL::Queries::LOAD_X1_STATS_FOR_PLAYER)
-			.value(),
+	batch.exec_prepared_then(
+		Core::Utils::SQL::Queries::LOAD_X1_STATS_FOR_PLAYER,
+		[data](const pqxx::result& result)
+		{
+			data->x1Stats->updateFromRow(result[0]);
+		},
 		data->userId);
-	data->x1Stats->updateFromRow(result[0]);
 }
 
 void X1Controller::onPlayerSave(
-	std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn)
+	std::shared_ptr<Core::PlayerModel> data, cp::pipeline_batch& batch)
 {
-	txn.exec_params(
-		Core::SQLQueryManager::Get()
-			->getQueryByName(Core::Utils::SQL::Queries::UPDATE_X1_STATS)
-			.value(),
+	batch.exec_prepared(Core::Utils::SQL::Queries::UPDATE_X1_STATS,
 		data->x1Stats->score, data->x1Stats->highestKillStreak,
 		data->x1Stats->kills, data->x1Stats->deaths, data->x1Stats->handKills,
 		data->x1Stats->handheldWeaponKills, data->x1Stats->meleeKills,
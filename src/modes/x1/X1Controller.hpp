@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../CbugDetector.hpp"
 #include "../ModeBase.hpp"
 #include "../../core/ModeManager.hpp"
 #include "../../core/commands/CommandManager.hpp"
@@ -18,7 +19,7 @@ namespace Modes::X1
 {
 inline const std::string X1_ROOM_INDEX = "roomIndex";
 inline const std::string X1_MODE_NAME = "X1";
-class X1Controller : public ModeBase, public PlayerSpawnEventHandler
+class X1Controller : public ModeBase
 {
 	void initCommands();
 	void initRooms();
@@ -41,6 +42,7 @@ class X1Controller : public ModeBase, public PlayerSpawnEventHandler
 	std::shared_ptr<Core::Utils::IDPool> virtualWorldIdPool;
 	IPlayerPool* playerPool;
 	ITimersComponent* timersComponent;
+	std::shared_ptr<CbugDetector> cbugDetector;
 
 public:
 	X1Controller(std::weak_ptr<Core::ModeManager> modeManager,
@@ -48,21 +50,26 @@ public:
 		std::shared_ptr<Core::Commands::CommandManager> commandManager,
 		std::shared_ptr<Core::DialogManager> dialogManager,
 		IPlayerPool* playerPool, ITimersComponent* timersComponent,
-		std::shared_ptr<dp::event_bus> bus);
+		std::shared_ptr<Core::Utils::EventBus> bus,
+		std::shared_ptr<CbugDetector> cbugDetector);
 	virtual ~X1Controller();
 
 	void onPlayerSpawn(IPlayer& player) override;
 	void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason) override;
+	void onPlayerKeyStateChange(
+		IPlayer& player, uint32_t newKeys, uint32_t oldKeys) override;
+	const Core::Player::PlayerSet* getRoomPlayers(IPlayer& player) override;
 
 	void onModeSelect(IPlayer& player) override;
 	void onModeJoin(IPlayer& player, JoinData joinData) override;
 	void onModeLeave(IPlayer& player) override;
-	void onPlayerOnFire(Core::Utils::Events::PlayerOnFireEvent event) override;
+	void onPlayerOnFire(
+		const Core::Utils::Events::PlayerOnFireEvent& event) override;
 	void onPlayerOnFireBeenKilled(
-		Core::Utils::Events::PlayerOnFireBeenKilled event) override;
-	void onPlayerLoad(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
-	void onPlayerSave(
-		std::shared_ptr<Core::PlayerModel> data, pqxx::work& txn) override;
+		const Core::Utils::Events::PlayerOnFireBeenKilled& event) override;
+	void onPlayerLoad(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
+	void onPlayerSave(std::shared_ptr<Core::PlayerModel> data,
+		cp::pipeline_batch& batch) override;
 };
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#include "Fixture.hpp"
+#include "core/ChatService.hpp"
+#include "core/ModeManager.hpp"
+#include "core/RateLimiter.hpp"
+#include "core/commands/CommandManager.hpp"
+#include "core/dialogs/DialogManager.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+namespace
+{
+/// The services chat goes through, over range(0) logged in players
+struct ChatFixture : Bench::GamemodeFixture
+{
+	std::shared_ptr<Core::RateLimiter> rateLimiter;
+	std::shared_ptr<Core::DialogManager> dialogManager;
+	std::shared_ptr<Core::Commands::CommandManager> commandManager;
+	std::shared_ptr<Core::ModeManager> modeManager;
+	std::unique_ptr<Core::ChatService> chat;
+
+	explicit ChatFixture(std::size_t playerCount)
+		: Bench::GamemodeFixture(playerCount)
+		, rateLimiter(std::make_shared<Core::RateLimiter>(&server.players))
+		, dialogManager(std::make_shared<Core::DialogManager>(
+			  &server.components, rateLimiter))
+		, commandManager(std::make_shared<Core::Commands::CommandManager>(
+			  &server.players, rateLimiter))
+		, modeManager(std::make_shared<Core::ModeManager>(
+			  dialogManager, &server.players, &server.timers))
+		, chat(std::make_unique<Core::ChatService>(&server.players,
+			  &server.timers, modeManager, commandManager, rateLimiter))
+	{
+	}
+};
+
+/// One chat line going out to everyone on the server
+void BM_ChatGlobal(benchmark::State& state)
+{
+	ChatFixture fixture(state.range(0));
+	auto& sender = *fixture.players[0];
+	for (auto iteration : state)
+	{
+		// refills the flood budget, see BM_CommandDispatch
+		fixture.rateLimiter->onPlayerConnect(sender);
+		fixture.chat->sendGlobal(sender, "gg everyone, one more round?");
+	}
+	state.counters["recipients"] = benchmark::Counter(
+		fixture.sentMessages(), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ChatGlobal)->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+
+/// Local chat with the players spread over the map, only the ones in
+/// range get the line
+void BM_ChatLocal(benchmark::State& state)
+{
+	ChatFixture fixture(state.range(0));
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> coordinate(-3000.0, 3000.0);
+	for (auto player : fixture.players)
+	{
+		player->setPosition(
+			Vector3(coordinate(random), coordinate(random), 10.0));
+		// puts the player in the position index where they are now
+		fixture.chat->onPlayerConnect(*player);
+	}
+	auto& sender = *fixture.players[0];
+	for (auto iteration : state)
+	{
+		fixture.rateLimiter->onPlayerConnect(sender);
+		fixture.chat->sendLocal(sender, "anyone around?");
+	}
+}
+BENCHMARK(BM_ChatLocal)->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+}
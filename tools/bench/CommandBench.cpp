@@ -0,0 +1,74 @@
+#include "Fixture.hpp"
+#include "core/RateLimiter.hpp"
+#include "core/commands/CommandManager.hpp"
+#include "core/utils/Strings.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace
+{
+bool acceptArgs(std::reference_wrapper<IPlayer> player, std::string args)
+{
+	benchmark::DoNotOptimize(args);
+	return true;
+}
+
+/// /name args, from the text the client sent to the handler being called
+void BM_CommandDispatch(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Commander");
+	auto rateLimiter
+		= std::make_shared<Core::RateLimiter>(&fixture.server.players);
+	Core::Commands::CommandManager commands(
+		&fixture.server.players, rateLimiter);
+	commands.addCommand("v", acceptArgs,
+		Core::Commands::CommandInfo {
+			.args = { "model" }, .description = "", .category = "general" });
+
+	for (auto iteration : state)
+	{
+		// refills the flood budget, every call past the first few would be
+		// turned away otherwise
+		rateLimiter->onPlayerConnect(player);
+		benchmark::DoNotOptimize(
+			commands.onPlayerCommandText(player, "/v  411 "));
+	}
+}
+BENCHMARK(BM_CommandDispatch);
+
+/// A command nobody registered, the server tries the next script with it
+void BM_CommandUnknown(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Commander");
+	auto rateLimiter
+		= std::make_shared<Core::RateLimiter>(&fixture.server.players);
+	Core::Commands::CommandManager commands(
+		&fixture.server.players, rateLimiter);
+
+	for (auto iteration : state)
+	{
+		rateLimiter->onPlayerConnect(player);
+		benchmark::DoNotOptimize(
+			commands.onPlayerCommandText(player, "/nosuchcommand 1 2"));
+	}
+}
+BENCHMARK(BM_CommandUnknown);
+
+void BM_StringsSplit(benchmark::State& state)
+{
+	std::string text(state.range(0) * 4, ' ');
+	for (std::size_t i = 0; i < text.size(); i += 4)
+		text.replace(i, 3, "411");
+
+	for (auto iteration : state)
+		benchmark::DoNotOptimize(Core::Utils::Strings::split(text, ' '));
+	state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(BM_StringsSplit)->Arg(3)->Arg(16)->Arg(128);
+}
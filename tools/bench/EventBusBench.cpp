@@ -0,0 +1,155 @@
+#include "Fixture.hpp"
+#include "core/utils/EventBus.hpp"
+
+#include <benchmark/benchmark.h>
+#include <eventbus/event_bus.hpp>
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+using Core::Utils::Events::PlayerOnFireEvent;
+using Core::Utils::Events::RoundEndEvent;
+
+/// RoundEndEvent as it was sent through dp::event_bus, with its own copy of
+/// the players
+struct CopiedRoundEndEvent
+{
+	Modes::Mode mode;
+	std::unordered_set<IPlayer*> players;
+};
+
+struct Listener
+{
+	std::size_t calls = 0;
+
+	void onPlayerOnFire(const PlayerOnFireEvent& event)
+	{
+		benchmark::DoNotOptimize(&event);
+		this->calls++;
+	}
+	void onRoundEnd(const RoundEndEvent& event)
+	{
+		benchmark::DoNotOptimize(&event);
+		this->calls++;
+	}
+	void onCopiedRoundEnd(const CopiedRoundEndEvent& event)
+	{
+		benchmark::DoNotOptimize(&event);
+		this->calls++;
+	}
+};
+
+using ListenerBus = Core::Utils::StaticEventBus<PlayerOnFireEvent,
+	RoundEndEvent>;
+
+/// An on-fire event reaching range(0) modes
+void BM_StaticBusFire(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture(2);
+	std::vector<Listener> listeners(state.range(0));
+	ListenerBus bus;
+	for (auto& listener : listeners)
+		bus.subscribe<&Listener::onPlayerOnFire>(&listener);
+
+	PlayerOnFireEvent event { *fixture.players[0], *fixture.players[1],
+		Modes::Mode::Deathmatch };
+	for (auto iteration : state)
+		bus.fire(event);
+}
+BENCHMARK(BM_StaticBusFire)->Arg(1)->Arg(5)->Arg(64);
+
+void BM_DpBusFire(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture(2);
+	std::vector<Listener> listeners(state.range(0));
+	dp::event_bus bus;
+	std::vector<dp::handler_registration> registrations;
+	for (auto& listener : listeners)
+		registrations.push_back(bus.register_handler<PlayerOnFireEvent>(
+			&listener, &Listener::onPlayerOnFire));
+
+	PlayerOnFireEvent event { *fixture.players[0], *fixture.players[1],
+		Modes::Mode::Deathmatch };
+	for (auto iteration : state)
+		bus.fire_event(event);
+}
+BENCHMARK(BM_DpBusFire)->Arg(1)->Arg(5)->Arg(64);
+
+/// The end of a round with range(0) players, sent to the five modes
+void BM_StaticBusRoundEnd(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture(state.range(0));
+	std::vector<Listener> listeners(5);
+	ListenerBus bus;
+	for (auto& listener : listeners)
+		bus.subscribe<&Listener::onRoundEnd>(&listener);
+
+	Core::Player::PlayerSet players;
+	for (auto player : fixture.players)
+		players.insert(*player);
+	for (auto iteration : state)
+		bus.fire(RoundEndEvent { Modes::Mode::Deathmatch, players });
+}
+BENCHMARK(BM_StaticBusRoundEnd)->Arg(8)->Arg(64);
+
+void BM_DpBusRoundEnd(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture(state.range(0));
+	std::vector<Listener> listeners(5);
+	dp::event_bus bus;
+	std::vector<dp::handler_registration> registrations;
+	for (auto& listener : listeners)
+		registrations.push_back(bus.register_handler<CopiedRoundEndEvent>(
+			&listener, &Listener::onCopiedRoundEnd));
+
+	std::unordered_set<IPlayer*> players(
+		fixture.players.begin(), fixture.players.end());
+	for (auto iteration : state)
+		bus.fire_event(
+			CopiedRoundEndEvent { Modes::Mode::Deathmatch, players });
+}
+BENCHMARK(BM_DpBusRoundEnd)->Arg(8)->Arg(64);
+
+/// A mode being created and destroyed while the others stay subscribed
+void BM_StaticBusSubscribe(benchmark::State& state)
+{
+	std::vector<Listener> listeners(5);
+	ListenerBus bus;
+	for (auto& listener : listeners)
+		bus.subscribe<&Listener::onPlayerOnFire>(&listener);
+
+	Listener listener;
+	for (auto iteration : state)
+	{
+		bus.subscribe<&Listener::onPlayerOnFire>(&listener);
+		bus.subscribe<&Listener::onRoundEnd>(&listener);
+		bus.unsubscribe(&listener);
+	}
+}
+BENCHMARK(BM_StaticBusSubscribe);
+
+void BM_DpBusSubscribe(benchmark::State& state)
+{
+	std::vector<Listener> listeners(5);
+	dp::event_bus bus;
+	std::vector<dp::handler_registration> registrations;
+	for (auto& listener : listeners)
+		registrations.push_back(bus.register_handler<PlayerOnFireEvent>(
+			&listener, &Listener::onPlayerOnFire));
+
+	Listener listener;
+	for (auto iteration : state)
+	{
+		auto onFire = bus.register_handler<PlayerOnFireEvent>(
+			&listener, &Listener::onPlayerOnFire);
+		auto onRoundEnd = bus.register_handler<CopiedRoundEndEvent>(
+			&listener, &Listener::onCopiedRoundEnd);
+		bus.remove_handler(onFire);
+		bus.remove_handler(onRoundEnd);
+	}
+}
+BENCHMARK(BM_DpBusSubscribe);
+}
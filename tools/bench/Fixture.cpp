@@ -0,0 +1,51 @@
+#include "Fixture.hpp"
+#include "core/utils/Localization.hpp"
+
+#include <cstdlib>
+
+namespace Bench
+{
+void loadTranslations()
+{
+	if (Localization::gDictionaryManager)
+		return;
+	auto directory = std::getenv("OASIS_LOCALE_DIR");
+	Localization::gDictionaryManager.reset(
+		new tinygettext::DictionaryManager());
+	Localization::gDictionaryManager->add_directory(
+		directory ? directory : OASIS_LOCALE_DIR);
+}
+
+GamemodeFixture::GamemodeFixture(
+	std::size_t playerCount, const std::string& language)
+{
+	loadTranslations();
+	this->server.core.verbose = false;
+	for (std::size_t i = 0; i < playerCount; i++)
+		this->connect("Player_" + std::to_string(i), language);
+}
+
+Stub::Player& GamemodeFixture::connect(
+	const std::string& name, const std::string& language)
+{
+	auto player = this->server.players.connect(name);
+	auto data = std::make_shared<Core::PlayerModel>();
+	data->name = name;
+	data->language = language;
+	data->tempData->core->isLoggedIn = true;
+	player->addExtension(
+		new Core::Player::OasisPlayerExt(data, *player, &this->server.timers),
+		true);
+	player->setColour(Colour::FromRGBA(0x33AA33FF));
+	this->players.push_back(player);
+	return *player;
+}
+
+std::size_t GamemodeFixture::sentMessages() const
+{
+	std::size_t messages = 0;
+	for (auto player : this->players)
+		messages += player->messages;
+	return messages;
+}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "core/player/PlayerExtension.hpp"
+#include "core/player/PlayerModel.hpp"
+
+#include "core/utils/AllocationTracker.hpp"
+
+#include <benchmark/benchmark.h>
+#include <stub/Server.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+/// Loads the translations from OASIS_LOCALE_DIR, or the ones in the source
+/// tree when it isn't set, so _() goes through tinygettext
+void loadTranslations();
+
+/// Reports the heap allocations per iteration of the benchmark as its
+/// "allocs" counter. Only counts when built with OASIS_TRACK_ALLOCATIONS.
+class AllocationCounter
+{
+#ifdef OASIS_TRACK_ALLOCATIONS
+	benchmark::State& state;
+	Core::Utils::AllocationCounters startedWith;
+
+public:
+	explicit AllocationCounter(benchmark::State& state)
+		: state(state)
+		, startedWith(Core::Utils::threadAllocations())
+	{
+	}
+
+	~AllocationCounter()
+	{
+		auto allocations = Core::Utils::threadAllocations().allocations
+			- this->startedWith.allocations;
+		this->state.counters["allocs"] = benchmark::Counter(
+			allocations, benchmark::Counter::kAvgIterations);
+	}
+#else
+public:
+	explicit AllocationCounter(benchmark::State&) { }
+#endif
+};
+
+/// A stub server whose players are logged in, the way the gamemode sees
+/// them once they got past the login dialog
+class GamemodeFixture
+{
+public:
+	Stub::Server server;
+	std::vector<Stub::Player*> players;
+
+	explicit GamemodeFixture(
+		std::size_t playerCount = 0, const std::string& language = "en");
+
+	Stub::Player& connect(
+		const std::string& name, const std::string& language = "en");
+	std::shared_ptr<Core::PlayerModel> getData(IPlayer& player)
+	{
+		return Core::Player::getPlayerData(player);
+	}
+	/// Messages the players have been sent so far
+	std::size_t sentMessages() const;
+};
+}
@@ -0,0 +1,42 @@
+#include "Fixture.hpp"
+#include "core/utils/Localization.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/printf.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+/// Every info message starts with it, and it has colours to expand
+const std::string PREFIX_MESSAGE = "#LIME#>>#WHITE#";
+
+void BM_TranslateCached(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Translator");
+	for (auto iteration : state)
+		benchmark::DoNotOptimize(_(PREFIX_MESSAGE, player));
+}
+BENCHMARK(BM_TranslateCached);
+
+/// Messages that were formatted before being translated miss the cache,
+/// this is what each of them costs
+void BM_TranslateUncached(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Translator");
+	std::vector<std::string> messages;
+	for (std::size_t i = 0; i < 2 * Localization::TRANSLATION_CACHE_LIMIT; i++)
+		messages.push_back(fmt::sprintf("#RED#Player_%d#WHITE# has left", i));
+
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		benchmark::DoNotOptimize(_(messages[next], player));
+		next = (next + 1) % messages.size();
+	}
+}
+BENCHMARK(BM_TranslateUncached);
+}
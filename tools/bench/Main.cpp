@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// Where the results go when --benchmark_out isn't given, in Google
+/// Benchmark's JSON format so runs can be compared with its compare.py
+inline const std::string DEFAULT_RESULTS_FILE = "oasis-bench.json";
+
+int main(int argc, char** argv)
+{
+	// rate limited players and the like would fill the console otherwise
+	spdlog::set_level(spdlog::level::err);
+
+	std::vector<char*> args(argv, argv + argc);
+	std::string out = "--benchmark_out=" + DEFAULT_RESULTS_FILE;
+	std::string outFormat = "--benchmark_out_format=json";
+	bool hasOut = std::any_of(args.begin(), args.end(),
+		[](std::string_view arg)
+		{
+			return arg.starts_with("--benchmark_out=");
+		});
+	if (!hasOut)
+	{
+		args.push_back(out.data());
+		args.push_back(outFormat.data());
+	}
+
+	int count = args.size();
+	benchmark::Initialize(&count, args.data());
+	if (benchmark::ReportUnrecognizedArguments(count, args.data()))
+		return 1;
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+	return 0;
+}
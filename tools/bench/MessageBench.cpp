@@ -0,0 +1,96 @@
+#include "Fixture.hpp"
+#include "core/utils/AllocationTracker.hpp"
+#include "core/utils/Localization.hpp"
+#include "core/utils/MessageBuilder.hpp"
+
+#include <benchmark/benchmark.h>
+#include <fmt/printf.h>
+
+#include <string>
+
+namespace
+{
+const std::string INFO_MESSAGE = "You are not in any mode!";
+const std::string DUEL_OFFER_MESSAGE
+	= "{%06x}%s(%d) #WHITE#sent you a duel offer, use /duela to accept it";
+
+/// A translated info message going through the message builder
+void BM_InfoMessage(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Receiver");
+	auto playerExt = Core::Player::getPlayerExt(player);
+	Bench::AllocationCounter allocations(state);
+	for (auto iteration : state)
+		playerExt->sendInfoMessage(INFO_MESSAGE);
+}
+BENCHMARK(BM_InfoMessage);
+
+/// The same message built the way it was before the message builder, the
+/// prefix and the message translated and joined with sprintf
+void BM_InfoMessageSprintf(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Receiver");
+	Bench::AllocationCounter allocations(state);
+	for (auto iteration : state)
+		player.sendClientMessage(Colour::White(),
+			fmt::sprintf("%s %s", _(Core::Player::INFO_MESSAGE_PREFIX, player),
+				_(INFO_MESSAGE, player)));
+}
+BENCHMARK(BM_InfoMessageSprintf);
+
+/// A message with printf-style arguments, translated before formatting
+void BM_FormattedMessage(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Receiver");
+	auto playerExt = Core::Player::getPlayerExt(player);
+	Bench::AllocationCounter allocations(state);
+	for (auto iteration : state)
+		playerExt->sendInfoMessage(
+			DUEL_OFFER_MESSAGE, 0x33AA33, "Challenger", 12);
+}
+BENCHMARK(BM_FormattedMessage);
+
+void BM_FormattedMessageSprintf(benchmark::State& state)
+{
+	Bench::GamemodeFixture fixture;
+	auto& player = fixture.connect("Receiver");
+	Bench::AllocationCounter allocations(state);
+	for (auto iteration : state)
+		player.sendClientMessage(Colour::White(),
+			fmt::sprintf("%s %s", _(Core::Player::INFO_MESSAGE_PREFIX, player),
+				fmt::sprintf(_(DUEL_OFFER_MESSAGE, player), 0x33AA33,
+					"Challenger", 12)));
+}
+BENCHMARK(BM_FormattedMessageSprintf);
+
+/// Building a message with printf-style arguments once the thread's buffer
+/// has grown to fit it. Fails the benchmark if that allocated.
+void BM_MessageBuilderPrintf(benchmark::State& state)
+{
+	const auto build = []
+	{
+		Core::Utils::MessageBuilder builder;
+		builder.append("[INFO] ").appendPrintf(
+			DUEL_OFFER_MESSAGE, 0x33AA33, "Challenger", 12);
+		return builder.view().size();
+	};
+	build();
+#ifdef OASIS_TRACK_ALLOCATIONS
+	auto startedWith = Core::Utils::threadAllocations().allocations;
+#endif
+	for (auto iteration : state)
+		benchmark::DoNotOptimize(build());
+#ifdef OASIS_TRACK_ALLOCATIONS
+	auto allocations
+		= Core::Utils::threadAllocations().allocations - startedWith;
+	state.counters["allocs"] = benchmark::Counter(
+		allocations, benchmark::Counter::kAvgIterations);
+	if (allocations != 0)
+		state.SkipWithError("building the message allocated");
+#endif
+}
+BENCHMARK(BM_MessageBuilderPrintf);
+}
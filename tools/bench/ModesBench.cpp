@@ -0,0 +1,39 @@
+#include "modes/deathmatch/DeathmatchResult.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+using Modes::Deathmatch::DeathmatchResult;
+
+/// The results of a round with range(0) players being ranked, every
+/// iteration sorts a fresh copy of the same unsorted results
+void BM_RoundResultsSort(benchmark::State& state)
+{
+	std::mt19937 random(42);
+	std::uniform_int_distribution<unsigned int> kills(0, 30);
+	std::uniform_real_distribution<float> damage(0.0, 3000.0);
+	std::vector<DeathmatchResult> results;
+	for (long i = 0; i < state.range(0); i++)
+		results.push_back(DeathmatchResult { .player = nullptr,
+			.kills = kills(random),
+			.deaths = kills(random),
+			.ratio = 1.0,
+			.damageInflicted = damage(random) });
+
+	std::vector<DeathmatchResult> ranked;
+	ranked.reserve(results.size());
+	for (auto iteration : state)
+	{
+		ranked.assign(results.begin(), results.end());
+		std::sort(
+			ranked.begin(), ranked.end(), Modes::Deathmatch::ranksHigher);
+		benchmark::DoNotOptimize(ranked.data());
+	}
+}
+BENCHMARK(BM_RoundResultsSort)->Arg(2)->Arg(16)->Arg(100);
+}
@@ -0,0 +1,45 @@
+#include "core/player/PlayerModel.hpp"
+
+#include <benchmark/benchmark.h>
+#include <pqxx/pqxx>
+
+#include <cstdlib>
+#include <memory>
+
+namespace
+{
+/// A row shaped like the one the login loads, without needing a player in
+/// the database
+const auto PLAYER_ROW_QUERY = R"(
+	SELECT 1::bigint AS id, 'Player_0' AS name, 'hash' AS password_hash,
+		'en' AS language, 'player@example.com' AS email,
+		'127.0.0.1' AS last_ip, 23::smallint AS last_skin_id,
+		'2024-01-01 12:00:00'::timestamp AS last_login_at,
+		'2023-01-01 12:00:00'::timestamp AS registration_date,
+		NULL::bigint AS ban_expires_at, NULL::text AS banned_by,
+		NULL::text AS ban_reason, NULL::smallint AS admin_level,
+		NULL::text AS admin_pass_hash)";
+
+/// Needs a database, OASIS_BENCH_DB is a libpq connection string for it
+void BM_UpdateFromRow(benchmark::State& state)
+{
+	auto connectionString = std::getenv("OASIS_BENCH_DB");
+	if (!connectionString)
+	{
+		state.SkipWithError("OASIS_BENCH_DB is not set");
+		return;
+	}
+	pqxx::connection connection(connectionString);
+	pqxx::nontransaction tx(connection);
+	auto result = tx.exec(PLAYER_ROW_QUERY);
+	auto row = result[0];
+
+	auto model = std::make_shared<Core::PlayerModel>();
+	for (auto iteration : state)
+	{
+		model->updateFromRow(row);
+		benchmark::DoNotOptimize(model.get());
+	}
+}
+BENCHMARK(BM_UpdateFromRow);
+}
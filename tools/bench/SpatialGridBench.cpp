@@ -0,0 +1,151 @@
+#include "core/utils/SpatialGrid.hpp"
+#include "modes/freeroam/FreeroamVehicles.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+using Modes::Freeroam::VEHICLE_TABLES;
+
+/// The freeroam vehicles where they spawn, the way the vehicle index holds
+/// them
+struct VehicleSet
+{
+	std::vector<std::pair<int, Vector3>> vehicles;
+	Core::Utils::SpatialGrid<int> grid;
+	std::vector<Vector3> centers;
+
+	VehicleSet()
+	{
+		for (const auto& table : VEHICLE_TABLES)
+		{
+			for (const auto& vehicle : table)
+			{
+				Vector3 position(vehicle.position.x, vehicle.position.y,
+					vehicle.position.z);
+				int id = this->vehicles.size();
+				this->grid.insert(id, position);
+				this->vehicles.emplace_back(id, position);
+			}
+		}
+		// players standing next to random vehicles, queries from empty
+		// parts of the map would flatter the grid
+		std::mt19937 random(42);
+		std::uniform_int_distribution<std::size_t> pick(
+			0, this->vehicles.size() - 1);
+		std::uniform_real_distribution<float> offset(-50.0, 50.0);
+		for (int i = 0; i < 256; i++)
+		{
+			auto position = this->vehicles[pick(random)].second;
+			this->centers.emplace_back(position.x + offset(random),
+				position.y + offset(random), position.z);
+		}
+	}
+
+	const Vector3& center(std::size_t iteration) const
+	{
+		return this->centers[iteration % this->centers.size()];
+	}
+};
+
+float distanceSq(const Vector3& a, const Vector3& b)
+{
+	float dx = a.x - b.x;
+	float dy = a.y - b.y;
+	return dx * dx + dy * dy;
+}
+
+/// Vehicles within range(0) units of a player
+void BM_GridRadius(benchmark::State& state)
+{
+	VehicleSet set;
+	const float radius = state.range(0);
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		std::size_t found = 0;
+		set.grid.forEachInRadius(set.center(next++), radius,
+			[&found](int, float)
+			{
+				found++;
+			});
+		benchmark::DoNotOptimize(found);
+	}
+}
+BENCHMARK(BM_GridRadius)->Arg(30)->Arg(150)->Arg(500);
+
+void BM_LinearRadius(benchmark::State& state)
+{
+	VehicleSet set;
+	const float radiusSq = state.range(0) * state.range(0);
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		const auto& center = set.center(next++);
+		std::size_t found = 0;
+		for (const auto& [id, position] : set.vehicles)
+		{
+			if (distanceSq(position, center) <= radiusSq)
+				found++;
+		}
+		benchmark::DoNotOptimize(found);
+	}
+}
+BENCHMARK(BM_LinearRadius)->Arg(30)->Arg(150)->Arg(500);
+
+/// The range(0) vehicles closest to a player, nearest first
+void BM_GridNearest(benchmark::State& state)
+{
+	VehicleSet set;
+	const std::size_t count = state.range(0);
+	std::size_t next = 0;
+	for (auto iteration : state)
+		benchmark::DoNotOptimize(set.grid.nearest(set.center(next++), count));
+}
+BENCHMARK(BM_GridNearest)->Arg(1)->Arg(10);
+
+void BM_LinearNearest(benchmark::State& state)
+{
+	VehicleSet set;
+	const std::size_t count = state.range(0);
+	std::vector<std::pair<float, int>> candidates;
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		const auto& center = set.center(next++);
+		candidates.clear();
+		for (const auto& [id, position] : set.vehicles)
+			candidates.emplace_back(distanceSq(position, center), id);
+		std::partial_sort(candidates.begin(), candidates.begin() + count,
+			candidates.end());
+		std::vector<int> result;
+		for (std::size_t i = 0; i < count; i++)
+			result.push_back(candidates[i].second);
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_LinearNearest)->Arg(1)->Arg(10);
+
+/// A driven vehicle reporting its new position, mostly within its cell
+void BM_GridUpdate(benchmark::State& state)
+{
+	VehicleSet set;
+	std::mt19937 random(42);
+	std::uniform_real_distribution<float> step(-5.0, 5.0);
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		auto& [id, position] = set.vehicles[next++ % set.vehicles.size()];
+		position.x += step(random);
+		position.y += step(random);
+		set.grid.update(id, position);
+	}
+}
+BENCHMARK(BM_GridUpdate);
+}
@@ -0,0 +1,28 @@
+#include "core/utils/IDPool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+/// Rooms being created and deleted once every virtual world id in range(0)
+/// is taken, the pool's steady state on a busy server
+void BM_IDPoolChurn(benchmark::State& state)
+{
+	Core::Utils::IDPool pool;
+	std::vector<unsigned int> ids;
+	for (long i = 0; i < state.range(0); i++)
+		ids.push_back(pool.allocateId());
+
+	std::size_t next = 0;
+	for (auto iteration : state)
+	{
+		pool.freeId(ids[next]);
+		ids[next] = pool.allocateId();
+		next = (next * 7 + 3) % ids.size();
+	}
+}
+BENCHMARK(BM_IDPoolChurn)->Arg(16)->Arg(256)->Arg(4096);
+}
@@ -0,0 +1,302 @@
+#include "LoadDriver.hpp"
+#include "core/player/PlayerExtension.hpp"
+#include "core/utils/AllocationTracker.hpp"
+
+#include <Server/Components/Classes/classes.hpp>
+#include <Server/Components/Dialogs/dialogs.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <chrono>
+#include <string_view>
+#include <thread>
+
+/// The gamemode's entry point, the way the server finds the component
+extern "C" IComponent* ComponentEntryPoint();
+
+namespace LoadDriver
+{
+namespace
+{
+const auto CHAT_LINES = std::to_array<std::string_view>({ "hi all",
+	"anyone up for a duel?", "gg", "where do I get a car",
+	"lag?", "brb", "nice shot", "which room is the best one" });
+/// the rest of the actions go to the main chat, or to the deathmatch room
+const auto LOCAL_CHAT = "/l anyone around?";
+const auto DEATHMATCH_ROOM_COMMAND = "/dm 1";
+/// Desert Eagle, one of the weapons every room hands out
+const int KILL_WEAPON = 24;
+}
+
+Driver::Driver(const Options& options)
+	: options(options)
+	, virtualPlayers(options.players)
+	, byId(PLAYER_POOL_SIZE, nullptr)
+	, random(options.seed)
+{
+	this->server.core.verbose = options.verbose;
+	std::bernoulli_distribution joinsDeathmatch(options.deathmatchShare);
+	for (std::size_t i = 0; i < this->virtualPlayers.size(); i++)
+	{
+		auto& virtualPlayer = this->virtualPlayers[i];
+		virtualPlayer.name = fmt::format("Load_{}", i);
+		virtualPlayer.joinsDeathmatch = joinsDeathmatch(this->random);
+	}
+}
+
+Driver::~Driver() { this->stopGamemode(); }
+
+void Driver::startGamemode()
+{
+	this->gamemode = ComponentEntryPoint();
+	this->server.components.add(this->gamemode);
+	this->gamemode->onLoad(&this->server.core);
+	this->gamemode->onInit(&this->server.components);
+	this->gamemode->onReady();
+}
+
+void Driver::stopGamemode()
+{
+	if (!this->gamemode)
+		return;
+	for (auto& virtualPlayer : this->virtualPlayers)
+		if (virtualPlayer.player)
+			this->disconnect(virtualPlayer, std::chrono::steady_clock::now());
+	this->gamemode->onFree(this->gamemode);
+	this->gamemode->free();
+	this->gamemode = nullptr;
+}
+
+void Driver::run()
+{
+	this->startGamemode();
+
+	const auto tickInterval = std::chrono::duration_cast<Microseconds>(
+		Seconds(1)) / this->options.tickRate;
+	auto now = std::chrono::steady_clock::now();
+	const auto warmupEnd = now + this->options.warmup;
+	const auto end = warmupEnd + this->options.duration;
+	auto nextReport = warmupEnd + this->options.reportInterval;
+	auto nextTick = now;
+
+	fmt::print("Warming up for {}s\n", this->options.warmup.count());
+	while (now < warmupEnd)
+	{
+		this->tick(now, false);
+		nextTick += tickInterval;
+		std::this_thread::sleep_until(nextTick);
+		now = std::chrono::steady_clock::now();
+	}
+
+	fmt::print("Running {} players for {}s at {} ticks/s\n",
+		this->options.players, this->options.duration.count(),
+		this->options.tickRate);
+	for (auto& virtualPlayer : this->virtualPlayers)
+		virtualPlayer.connectAt = now;
+	this->stats.start(now);
+	while (now < end)
+	{
+		this->tick(now, true);
+		if (now >= nextReport)
+		{
+			this->stats.report(now, this->server.players.players().size());
+			nextReport += this->options.reportInterval;
+		}
+
+		// a tick that ran late pushes the next ones back, like the server
+		// does, instead of running the missed ones back to back
+		nextTick = std::max(nextTick + tickInterval,
+			std::chrono::steady_clock::now());
+		std::this_thread::sleep_until(nextTick);
+		now = std::chrono::steady_clock::now();
+	}
+	this->stats.summary(now, this->server.players.players().size());
+}
+
+void Driver::tick(TimePoint now, bool measured)
+{
+#ifdef OASIS_TRACK_ALLOCATIONS
+	auto allocationsBefore = Core::Utils::threadAllocations().allocations;
+#endif
+	auto startedAt = std::chrono::steady_clock::now();
+
+	this->connectBudget
+		= std::min(this->connectBudget
+				+ double(this->options.connectsPerSecond)
+					/ this->options.tickRate,
+			double(this->options.connectsPerSecond));
+	this->deathmatchPlayers.clear();
+	for (auto player : this->server.players.players())
+	{
+		auto playerExt = Core::Player::getPlayerExt(*player);
+		if (playerExt->isInAnyMode()
+			&& playerExt->getMode() == Modes::Mode::Deathmatch
+			&& player->getState() != PlayerState_Wasted)
+			this->deathmatchPlayers.push_back(
+				static_cast<Stub::Player*>(player));
+	}
+	if (measured)
+		for (auto& virtualPlayer : this->virtualPlayers)
+			this->script(virtualPlayer, now);
+	this->server.tick();
+
+	if (!measured)
+		return;
+	auto duration = std::chrono::duration_cast<Microseconds>(
+		std::chrono::steady_clock::now() - startedAt);
+	std::uint64_t allocations = 0;
+#ifdef OASIS_TRACK_ALLOCATIONS
+	allocations
+		= Core::Utils::threadAllocations().allocations - allocationsBefore;
+#endif
+	this->stats.record(duration, allocations);
+}
+
+void Driver::script(VirtualPlayer& virtualPlayer, TimePoint now)
+{
+	if (!virtualPlayer.player)
+	{
+		if (now >= virtualPlayer.connectAt && this->connectBudget >= 1.0)
+		{
+			this->connectBudget -= 1.0;
+			this->connect(virtualPlayer, now);
+		}
+		return;
+	}
+	auto& player = *virtualPlayer.player;
+	if (now >= virtualPlayer.disconnectAt || player.isKicked())
+	{
+		this->disconnect(virtualPlayer, now);
+		return;
+	}
+	if (this->answerDialog(virtualPlayer, now))
+		return;
+	if (!Core::Player::getPlayerData(player)->tempData->core->isLoggedIn)
+		return;
+
+	if (!virtualPlayer.spawnRequested)
+	{
+		// the class selection screen, then the spawn button
+		std::uniform_int_distribution<unsigned int> skin(
+			0, this->server.classes.count() - 1);
+		this->server.classes.requestClass(player, skin(this->random));
+		this->server.players.requestSpawn(player);
+		virtualPlayer.spawnRequested = true;
+		return;
+	}
+	if (player.getState() == PlayerState_Wasted)
+	{
+		if (now >= virtualPlayer.respawnAt)
+			player.spawn();
+		return;
+	}
+	if (now >= virtualPlayer.nextAction)
+	{
+		this->act(virtualPlayer, now);
+		virtualPlayer.nextAction = this->after(now, Seconds(2), Seconds(10));
+	}
+}
+
+void Driver::connect(VirtualPlayer& virtualPlayer, TimePoint now)
+{
+	auto player = this->server.players.connect(virtualPlayer.name);
+	if (!player)
+		return;
+	virtualPlayer.player = player;
+	virtualPlayer.spawnRequested = false;
+	virtualPlayer.dialogsSeen = 0;
+	virtualPlayer.nextAction = this->after(now, Seconds(0), Seconds(10));
+	virtualPlayer.disconnectAt = this->after(now,
+		this->options.duration / 4, this->options.duration / 2);
+	this->byId[player->getID()] = &virtualPlayer;
+}
+
+void Driver::disconnect(VirtualPlayer& virtualPlayer, TimePoint now)
+{
+	this->byId[virtualPlayer.player->getID()] = nullptr;
+	this->server.players.disconnect(*virtualPlayer.player);
+	virtualPlayer.player = nullptr;
+	virtualPlayer.connectAt = this->after(now, Seconds(5), Seconds(30));
+}
+
+bool Driver::answerDialog(VirtualPlayer& virtualPlayer, TimePoint now)
+{
+	auto& player = *virtualPlayer.player;
+	auto dialog = static_cast<Stub::PlayerDialogData*>(
+		queryExtension<IPlayerDialogData>(player));
+	if (!dialog || dialog->activeId == INVALID_DIALOG_ID)
+		return false;
+	if (dialog->shown != virtualPlayer.dialogsSeen)
+	{
+		virtualPlayer.dialogsSeen = dialog->shown;
+		virtualPlayer.answerAt
+			= this->after(now, Milliseconds(300), Milliseconds(2000));
+	}
+	if (now < virtualPlayer.answerAt)
+		return true;
+
+	auto& dialogs = this->server.dialogs;
+	switch (dialog->style)
+	{
+	case DialogStyle_PASSWORD:
+		// registration and login alike
+		dialogs.respond(
+			player, DialogResponse_Left, 0, VIRTUAL_PLAYER_PASSWORD);
+		break;
+	case DialogStyle_INPUT:
+		// the email one, which can be skipped
+		dialogs.respond(player, DialogResponse_Right);
+		break;
+	default:
+		// the first language, mode, room and so on
+		dialogs.respond(player, DialogResponse_Left, 0);
+		break;
+	}
+	return true;
+}
+
+void Driver::act(VirtualPlayer& virtualPlayer, TimePoint now)
+{
+	auto& player = *virtualPlayer.player;
+	auto playerExt = Core::Player::getPlayerExt(player);
+	if (!playerExt->isInAnyMode())
+		return;
+	bool inDeathmatch = playerExt->getMode() == Modes::Mode::Deathmatch;
+	if (virtualPlayer.joinsDeathmatch && !inDeathmatch)
+	{
+		this->server.players.command(player, DEATHMATCH_ROOM_COMMAND);
+		return;
+	}
+
+	std::uniform_int_distribution<int> action(0, 9);
+	auto roll = action(this->random);
+	if (inDeathmatch && roll < 6)
+		this->kill(player, now);
+	else if (roll < 8)
+	{
+		std::uniform_int_distribution<std::size_t> line(
+			0, CHAT_LINES.size() - 1);
+		this->server.players.text(player, CHAT_LINES[line(this->random)]);
+	}
+	else
+		this->server.players.command(player, LOCAL_CHAT);
+}
+
+void Driver::kill(Stub::Player& killer, TimePoint now)
+{
+	if (this->deathmatchPlayers.size() < 2)
+		return;
+	std::uniform_int_distribution<std::size_t> pick(
+		0, this->deathmatchPlayers.size() - 1);
+	auto victim = this->deathmatchPlayers[pick(this->random)];
+	if (victim == &killer || victim->getState() == PlayerState_Wasted)
+		return;
+
+	// a few hits before the one that kills
+	for (int hit = 0; hit < 3; hit++)
+		this->server.players.damage(*victim, killer, 46.2, KILL_WEAPON);
+	this->server.players.kill(*victim, &killer, KILL_WEAPON);
+	if (auto virtualVictim = this->byId[victim->getID()])
+		virtualVictim->respawnAt = now + RESPAWN_DELAY;
+}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "TickStats.hpp"
+
+#include <stub/Server.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace LoadDriver
+{
+/// Password every virtual player registers and logs in with
+inline const std::string VIRTUAL_PLAYER_PASSWORD = "loadtest123";
+/// how long a killed player stays dead, the client's respawn delay
+inline const auto RESPAWN_DELAY = Seconds(3);
+
+struct Options
+{
+	std::size_t players = 500;
+	Seconds duration = Seconds(300);
+	/// ticks run before any player connects, while the world is created
+	Seconds warmup = Seconds(5);
+	/// open.mp sleeps 5 ms between ticks by default
+	unsigned int tickRate = 200;
+	unsigned int connectsPerSecond = 20;
+	/// players who go to the deathmatch room instead of staying in freeroam
+	float deathmatchShare = 0.5;
+	Seconds reportInterval = Seconds(10);
+	unsigned int seed = 1;
+	bool verbose = false;
+};
+
+/// A scripted client: it connects, gets through the login dialogs, picks a
+/// mode and then chats, kills and dies in it until it leaves, to come back
+/// a little later as a returning player.
+struct VirtualPlayer
+{
+	std::string name;
+	Stub::Player* player = nullptr;
+	bool joinsDeathmatch = false;
+	bool spawnRequested = false;
+	/// dialogs shown to the player so far, a new one is read for a moment
+	/// before being answered
+	std::size_t dialogsSeen = 0;
+	TimePoint answerAt;
+	TimePoint connectAt;
+	TimePoint disconnectAt;
+	TimePoint nextAction;
+	TimePoint respawnAt;
+};
+
+/// Runs the gamemode on the stub server with virtual players, the way the
+/// server would with real ones, and reports how long the ticks take.
+/// Everything the players do happens on the main thread between ticks,
+/// like a client packet does, and counts towards the tick it happens in.
+class Driver
+{
+	Options options;
+	Stub::Server server;
+	IComponent* gamemode = nullptr;
+	std::vector<VirtualPlayer> virtualPlayers;
+	std::vector<VirtualPlayer*> byId;
+	std::vector<Stub::Player*> deathmatchPlayers;
+	std::mt19937 random;
+	TickStats stats;
+	double connectBudget = 0.0;
+
+	template <typename Rep, typename Period>
+	TimePoint after(TimePoint now, std::chrono::duration<Rep, Period> from,
+		std::chrono::duration<Rep, Period> to)
+	{
+		std::uniform_int_distribution<Rep> distribution(
+			from.count(), to.count());
+		return now
+			+ std::chrono::duration<Rep, Period>(distribution(this->random));
+	}
+
+	void startGamemode();
+	void stopGamemode();
+	/// One tick of the server with everything the players did since the
+	/// previous one
+	void tick(TimePoint now, bool measured);
+	void script(VirtualPlayer& virtualPlayer, TimePoint now);
+	void connect(VirtualPlayer& virtualPlayer, TimePoint now);
+	void disconnect(VirtualPlayer& virtualPlayer, TimePoint now);
+	/// Answers the dialog on the player's screen the way a new or a
+	/// returning player would, false if there is none
+	bool answerDialog(VirtualPlayer& virtualPlayer, TimePoint now);
+	void act(VirtualPlayer& virtualPlayer, TimePoint now);
+	void kill(Stub::Player& killer, TimePoint now);
+
+public:
+	explicit Driver(const Options& options);
+	~Driver();
+
+	void run();
+};
+}
@@ -0,0 +1,130 @@
+#include "LoadDriver.hpp"
+
+#include <fmt/format.h>
+
+#include <exception>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace
+{
+constexpr auto USAGE = R"(Usage: oasis-load-driver [options]
+
+Runs the gamemode against a stub server with scripted players and reports
+tick durations, allocations per tick and database calls per second. The
+database is the one in DB_CONNECTION_STRING, or in the .env file of the
+server directory.
+
+Options:
+  --players=N             virtual players, at most {} (default {})
+  --duration=SECONDS      how long the players are driven (default {})
+  --warmup=SECONDS        ticks run before anyone connects (default {})
+  --tick-rate=N           server ticks per second (default {})
+  --connects-per-second=N how fast players join (default {})
+  --deathmatch-share=F    share of players going to deathmatch (default {})
+  --report-interval=SECONDS
+                          time between reports (default {})
+  --seed=N                seed of the player scripts (default {})
+  --server-dir=PATH       where locale/ and .env are (default {})
+  --verbose               print what the gamemode prints to the console
+  --help                  show this
+)";
+
+void printUsage(const LoadDriver::Options& defaults)
+{
+	fmt::print(USAGE, PLAYER_POOL_SIZE, defaults.players,
+		defaults.duration.count(), defaults.warmup.count(), defaults.tickRate,
+		defaults.connectsPerSecond, defaults.deathmatchShare,
+		defaults.reportInterval.count(), defaults.seed, OASIS_SERVER_DIR);
+}
+
+/// Reads one --name=value argument into options, false if it isn't one
+bool parseOption(std::string_view argument, LoadDriver::Options& options,
+	std::string& serverDir)
+{
+	if (argument == "--verbose")
+	{
+		options.verbose = true;
+		return true;
+	}
+	auto separator = argument.find('=');
+	if (!argument.starts_with("--") || separator == std::string_view::npos)
+		return false;
+	auto name = argument.substr(2, separator - 2);
+	auto value = std::string(argument.substr(separator + 1));
+
+	if (name == "players")
+		options.players = std::stoul(value);
+	else if (name == "duration")
+		options.duration = Seconds(std::stoul(value));
+	else if (name == "warmup")
+		options.warmup = Seconds(std::stoul(value));
+	else if (name == "tick-rate")
+		options.tickRate = std::stoul(value);
+	else if (name == "connects-per-second")
+		options.connectsPerSecond = std::stoul(value);
+	else if (name == "deathmatch-share")
+		options.deathmatchShare = std::stof(value);
+	else if (name == "report-interval")
+		options.reportInterval = Seconds(std::stoul(value));
+	else if (name == "seed")
+		options.seed = std::stoul(value);
+	else if (name == "server-dir")
+		serverDir = value;
+	else
+		return false;
+	return true;
+}
+}
+
+int main(int argc, char** argv)
+{
+	const LoadDriver::Options defaults;
+	LoadDriver::Options options;
+	std::string serverDir = OASIS_SERVER_DIR;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::string_view(argv[i]) == "--help")
+		{
+			printUsage(defaults);
+			return 0;
+		}
+		bool parsed = false;
+		try
+		{
+			parsed = parseOption(argv[i], options, serverDir);
+		}
+		catch (const std::exception&)
+		{
+		}
+		if (!parsed)
+		{
+			fmt::print(stderr, "Invalid option {}\n\n", argv[i]);
+			printUsage(defaults);
+			return 1;
+		}
+	}
+	if (options.players > PLAYER_POOL_SIZE || options.tickRate == 0
+		|| options.connectsPerSecond == 0
+		|| options.reportInterval.count() == 0)
+	{
+		printUsage(defaults);
+		return 1;
+	}
+
+	try
+	{
+		// the gamemode loads the translations and .env relative to where the
+		// server runs
+		std::filesystem::current_path(serverDir);
+		LoadDriver::Driver driver(options);
+		driver.run();
+	}
+	catch (const std::exception& e)
+	{
+		fmt::print(stderr, "Load driver failed: {}\n", e.what());
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include "TickStats.hpp"
+#include "core/utils/Metrics.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+namespace LoadDriver
+{
+namespace
+{
+double databaseCounter(const std::string& name)
+{
+	return Core::Utils::metrics().value(name).value_or(0.0);
+}
+
+double milliseconds(Microseconds duration)
+{
+	return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+/// Nearest-rank percentile, sorts the durations
+Microseconds percentile(std::vector<Microseconds>& durations, double rank)
+{
+	std::sort(durations.begin(), durations.end());
+	auto index = static_cast<std::size_t>(rank * (durations.size() - 1));
+	return durations[index];
+}
+}
+
+void TickStats::start(TimePoint now)
+{
+	this->intervalStart = this->runStart = now;
+	this->intervalStatements = this->runStatements
+		= databaseCounter("oasis_db_statements_total");
+	this->intervalRoundTrips = this->runRoundTrips
+		= databaseCounter("oasis_db_round_trips_total");
+}
+
+void TickStats::record(Microseconds duration, std::uint64_t allocations)
+{
+	this->intervalDurations.push_back(duration);
+	this->runDurations.push_back(duration);
+	this->intervalAllocations += allocations;
+	this->runAllocations += allocations;
+}
+
+void TickStats::print(const char* label,
+	std::vector<Microseconds>& durations, std::uint64_t allocations,
+	double statements, double roundTrips, Microseconds elapsed,
+	std::size_t players)
+{
+	if (durations.empty())
+		return;
+	double seconds = std::chrono::duration<double>(elapsed).count();
+	fmt::print("{:>8} | {:4} players | tick p50 {:6.3f} ms p95 {:6.3f} ms "
+			   "p99 {:6.3f} ms max {:7.3f} ms",
+		label, players, milliseconds(percentile(durations, 0.5)),
+		milliseconds(percentile(durations, 0.95)),
+		milliseconds(percentile(durations, 0.99)),
+		milliseconds(durations.back()));
+#ifdef OASIS_TRACK_ALLOCATIONS
+	fmt::print(" | {:7.1f} allocs/tick",
+		double(allocations) / double(durations.size()));
+#endif
+	fmt::print(" | db {:7.1f} statements/s {:7.1f} round-trips/s\n",
+		statements / seconds, roundTrips / seconds);
+}
+
+void TickStats::report(TimePoint now, std::size_t players)
+{
+	auto statements = databaseCounter("oasis_db_statements_total");
+	auto roundTrips = databaseCounter("oasis_db_round_trips_total");
+	auto elapsed
+		= std::chrono::duration_cast<Microseconds>(now - this->intervalStart);
+	auto sinceStart
+		= std::chrono::duration_cast<Seconds>(now - this->runStart);
+	this->print(fmt::format("{}s", sinceStart.count()).c_str(),
+		this->intervalDurations, this->intervalAllocations,
+		statements - this->intervalStatements,
+		roundTrips - this->intervalRoundTrips, elapsed, players);
+
+	this->intervalDurations.clear();
+	this->intervalAllocations = 0;
+	this->intervalStart = now;
+	this->intervalStatements = statements;
+	this->intervalRoundTrips = roundTrips;
+}
+
+void TickStats::summary(TimePoint now, std::size_t players)
+{
+	auto elapsed
+		= std::chrono::duration_cast<Microseconds>(now - this->runStart);
+	this->print("total", this->runDurations, this->runAllocations,
+		databaseCounter("oasis_db_statements_total") - this->runStatements,
+		databaseCounter("oasis_db_round_trips_total") - this->runRoundTrips,
+		elapsed, players);
+}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LoadDriver
+{
+/// Tick durations and allocations of the run, and the database counters
+/// sampled at each report, so every report covers the time since the
+/// previous one and the summary covers the whole run.
+class TickStats
+{
+	std::vector<Microseconds> intervalDurations;
+	std::vector<Microseconds> runDurations;
+	std::uint64_t intervalAllocations = 0;
+	std::uint64_t runAllocations = 0;
+
+	TimePoint intervalStart;
+	TimePoint runStart;
+	double intervalStatements = 0.0;
+	double intervalRoundTrips = 0.0;
+	double runStatements = 0.0;
+	double runRoundTrips = 0.0;
+
+	void print(const char* label, std::vector<Microseconds>& durations,
+		std::uint64_t allocations, double statements, double roundTrips,
+		Microseconds elapsed, std::size_t players);
+
+public:
+	/// Starts counting from now, the ticks before it are left out
+	void start(TimePoint now);
+	void record(Microseconds duration, std::uint64_t allocations);
+	/// Prints the ticks since the previous report and starts over
+	void report(TimePoint now, std::size_t players);
+	void summary(TimePoint now, std::size_t players);
+};
+}
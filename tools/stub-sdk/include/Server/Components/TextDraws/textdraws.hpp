@@ -0,0 +1,66 @@
+#pragma once
+
+#include <player.hpp>
+#include <sdk.hpp>
+
+/// The subset of the open.mp SDK's TextDraws component the gamemode uses.
+
+enum TextDrawAlignmentTypes
+{
+	TextDrawAlignment_Default,
+	TextDrawAlignment_Left,
+	TextDrawAlignment_Center,
+	TextDrawAlignment_Right
+};
+
+enum TextDrawStyle
+{
+	TextDrawStyle_0,
+	TextDrawStyle_1,
+	TextDrawStyle_2,
+	TextDrawStyle_3,
+	TextDrawStyle_4,
+	TextDrawStyle_5,
+	TextDrawStyle_FontBeckettRegular = 0,
+	TextDrawStyle_FontAharoniBold,
+	TextDrawStyle_FontBankGothic,
+	TextDrawStyle_FontPricedown,
+	TextDrawStyle_Sprite,
+	TextDrawStyle_Preview
+};
+
+struct ITextDrawBase : public IExtensible, public IIDProvider
+{
+	virtual Vector2 getPosition() const = 0;
+	virtual ITextDrawBase& setPosition(Vector2 position) = 0;
+	virtual void setText(StringView text) = 0;
+	virtual StringView getText() const = 0;
+	virtual ITextDrawBase& setLetterSize(Vector2 size) = 0;
+	virtual ITextDrawBase& setTextSize(Vector2 size) = 0;
+	virtual ITextDrawBase& setAlignment(TextDrawAlignmentTypes alignment) = 0;
+	virtual ITextDrawBase& setColour(Colour colour) = 0;
+	virtual ITextDrawBase& useBox(bool use) = 0;
+	virtual ITextDrawBase& setBoxColour(Colour colour) = 0;
+	virtual ITextDrawBase& setShadow(int shadow) = 0;
+	virtual ITextDrawBase& setOutline(int outline) = 0;
+	virtual ITextDrawBase& setBackgroundColour(Colour colour) = 0;
+	virtual ITextDrawBase& setStyle(TextDrawStyle style) = 0;
+	virtual ITextDrawBase& setProportional(bool proportional) = 0;
+	virtual ITextDrawBase& setSelectable(bool selectable) = 0;
+};
+
+struct IPlayerTextDraw : public ITextDrawBase
+{
+	virtual void show() = 0;
+	virtual void hide() = 0;
+	virtual bool isShown() const = 0;
+};
+
+static const UID PlayerTextDrawData_UID = UID(0xbf08495682312400);
+struct IPlayerTextDrawData : public IExtension, public IPool<IPlayerTextDraw>
+{
+	PROVIDE_EXT_UID(PlayerTextDrawData_UID);
+
+	virtual IPlayerTextDraw* create(Vector2 position, StringView text) = 0;
+	virtual IPlayerTextDraw* create(Vector2 position, int model) = 0;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Server/Components/Timers/timers.hpp>
+
+#include <functional>
+
+namespace Impl
+{
+struct SimpleTimerHandler final : public TimerTimeOutHandler
+{
+	using Callback = std::function<void()>;
+
+	explicit SimpleTimerHandler(Callback cb)
+		: cb_(std::move(cb))
+	{
+	}
+
+	void timeout(ITimer& timer) override { cb_(); }
+	void free() override { delete this; }
+
+private:
+	Callback cb_;
+};
+}
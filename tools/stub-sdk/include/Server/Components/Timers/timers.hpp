@@ -0,0 +1,34 @@
+#pragma once
+
+#include <sdk.hpp>
+
+/// The subset of the open.mp SDK's Timers component the gamemode uses.
+
+struct TimerTimeOutHandler
+{
+	virtual void timeout(struct ITimer& timer) = 0;
+	virtual void free() = 0;
+	virtual ~TimerTimeOutHandler() = default;
+};
+
+struct ITimer
+{
+	virtual bool running() const = 0;
+	virtual Milliseconds remaining() const = 0;
+	virtual bool repeating() const = 0;
+	virtual Milliseconds interval() const = 0;
+	virtual TimerTimeOutHandler* handler() const = 0;
+	virtual void kill() = 0;
+	virtual void trigger() = 0;
+};
+
+static const UID TimersComponent_UID = UID(0x2ad8124c5ea257a3);
+struct ITimersComponent : public IComponent
+{
+	PROVIDE_UID(TimersComponent_UID);
+
+	virtual ITimer* create(
+		TimerTimeOutHandler* handler, Milliseconds interval, bool repeating)
+		= 0;
+	virtual const FlatPtrHashSet<ITimer>& timers() const = 0;
+};
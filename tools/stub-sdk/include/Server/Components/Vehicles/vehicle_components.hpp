@@ -0,0 +1,5 @@
+#pragma once
+
+#include "vehicles.hpp"
+
+/// The subset of the open.mp SDK's vehicle_components.hpp the gamemode uses.
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <player.hpp>
+#include <sdk.hpp>
+
+/// The subset of the open.mp SDK's Vehicles component the gamemode uses.
+
+struct VehicleSpawnData
+{
+	Seconds respawnDelay;
+	int modelID;
+	Vector3 position;
+	float zRotation;
+	int colour1;
+	int colour2;
+	bool siren = false;
+	int interior = 0;
+};
+
+struct UnoccupiedVehicleUpdate
+{
+	uint8_t seat;
+	Vector3 position;
+	Vector3 velocity;
+};
+
+struct IVehicle : public IExtensible, public IEntity
+{
+	virtual void setSpawnData(const VehicleSpawnData& data) = 0;
+	virtual void getSpawnData(VehicleSpawnData& data) = 0;
+	virtual void putPlayer(IPlayer& player, int seatID) = 0;
+	virtual void setPlate(StringView plate) = 0;
+	virtual StringView getPlate() = 0;
+	virtual Vector3 getVelocity() = 0;
+	virtual void setVelocity(Vector3 velocity) = 0;
+	virtual IPlayer* getDriver() = 0;
+	virtual int getModel() = 0;
+	virtual void respawn() = 0;
+};
+
+struct VehicleEventHandler
+{
+	virtual void onVehicleStreamIn(IVehicle& vehicle, IPlayer& player) { }
+	virtual void onVehicleStreamOut(IVehicle& vehicle, IPlayer& player) { }
+	virtual void onVehicleDeath(IVehicle& vehicle, IPlayer& player) { }
+	virtual void onPlayerEnterVehicle(
+		IPlayer& player, IVehicle& vehicle, bool passenger)
+	{
+	}
+	virtual void onPlayerExitVehicle(IPlayer& player, IVehicle& vehicle) { }
+	virtual void onVehicleSpawn(IVehicle& vehicle) { }
+	virtual bool onUnoccupiedVehicleUpdate(IVehicle& vehicle, IPlayer& player,
+		UnoccupiedVehicleUpdate const updateData)
+	{
+		return true;
+	}
+};
+
+static const UID PlayerVehicleData_UID = UID(0xa960485be6c70fb2);
+struct IPlayerVehicleData : public IExtension
+{
+	PROVIDE_EXT_UID(PlayerVehicleData_UID);
+
+	virtual IVehicle* getVehicle() = 0;
+	virtual void resetVehicle() = 0;
+	virtual int getSeat() const = 0;
+	virtual bool isInModShop() const = 0;
+};
+
+static const UID VehiclesComponent_UID = UID(0x3f1f62ee9e22ab19);
+struct IVehiclesComponent : public IPool<IVehicle>, public IComponent
+{
+	PROVIDE_UID(VehiclesComponent_UID);
+
+	virtual IEventDispatcher<VehicleEventHandler>& getEventDispatcher() = 0;
+
+	virtual IVehicle* create(bool isStatic, int modelID, Vector3 position,
+		float Z = 0.0f, int colour1 = -1, int colour2 = -1,
+		Seconds respawnDelay = Seconds(-1), bool addSiren = false)
+		= 0;
+	virtual IVehicle* create(const VehicleSpawnData& data) = 0;
+};
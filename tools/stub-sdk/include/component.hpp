@@ -0,0 +1,106 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+
+/// The subset of the open.mp SDK's component.hpp the gamemode uses.
+
+typedef uint64_t UID;
+
+#define PROVIDE_UID(uuid)                                                      \
+	static constexpr UID IOmpUID = uuid;                                       \
+	UID getUID() override { return uuid; }
+
+#define PROVIDE_EXT_UID(uuid)                                                  \
+	static constexpr UID ExtensionIID = uuid;                                  \
+	UID getExtensionID() override { return ExtensionIID; }
+
+struct IUIDProvider
+{
+	virtual UID getUID() = 0;
+};
+
+struct IExtension
+{
+	virtual UID getExtensionID() = 0;
+	virtual void freeExtension() { delete this; }
+	virtual void reset() { }
+	virtual ~IExtension() = default;
+};
+
+struct IExtensible
+{
+	virtual IExtension* getExtension(UID id) = 0;
+
+	template <class ExtensionT>
+	ExtensionT* queryExtension()
+	{
+		return static_cast<ExtensionT*>(
+			this->getExtension(ExtensionT::ExtensionIID));
+	}
+
+	virtual bool addExtension(IExtension* extension, bool autoDeleteExt) = 0;
+	virtual bool removeExtension(IExtension* extension) = 0;
+
+protected:
+	~IExtensible() = default;
+};
+
+template <class ExtensionT>
+ExtensionT* queryExtension(IExtensible* extensible)
+{
+	return extensible ? extensible->queryExtension<ExtensionT>() : nullptr;
+}
+
+template <class ExtensionT>
+ExtensionT* queryExtension(IExtensible& extensible)
+{
+	return extensible.queryExtension<ExtensionT>();
+}
+
+struct ICore;
+struct IComponentList;
+
+enum class ComponentType
+{
+	Other,
+	Network,
+	Pool,
+};
+
+struct IComponent : public IExtensible, public IUIDProvider
+{
+	virtual int supportedVersion() const { return 0; }
+	virtual StringView componentName() const = 0;
+	virtual SemanticVersion componentVersion() const = 0;
+	virtual ComponentType componentType() const { return ComponentType::Other; }
+	virtual void onLoad(ICore* c) = 0;
+	virtual void onInit(IComponentList* components) { }
+	virtual void onReady() { }
+	virtual void onFree(IComponent* component) { }
+	virtual void free() = 0;
+	virtual void reset() = 0;
+
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+};
+
+struct IComponentList : public IExtensible
+{
+	virtual IComponent* queryComponent(UID id) = 0;
+
+	template <class ComponentT>
+	ComponentT* queryComponent()
+	{
+		return static_cast<ComponentT*>(queryComponent(ComponentT::IOmpUID));
+	}
+};
+
+#define COMPONENT_ENTRY_POINT()                                                \
+	extern "C" IComponent* ComponentEntryPoint()
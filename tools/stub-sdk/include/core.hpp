@@ -0,0 +1,41 @@
+#pragma once
+
+#include "component.hpp"
+#include "events.hpp"
+#include "player.hpp"
+#include "types.hpp"
+
+/// The subset of the open.mp SDK's core.hpp the gamemode uses.
+
+enum class SettableCoreDataType
+{
+	ServerName,
+	ModeText,
+	MapName,
+	Language,
+	Password,
+	AdminPassword,
+	URL,
+};
+
+struct IConfig : public IExtensible
+{
+	virtual bool* getBool(StringView key) = 0;
+	virtual int* getInt(StringView key) = 0;
+	virtual float* getFloat(StringView key) = 0;
+};
+
+struct CoreEventHandler
+{
+	virtual void onTick(Microseconds elapsed, TimePoint now) = 0;
+};
+
+struct ICore : public IExtensible
+{
+	virtual IPlayerPool& getPlayers() = 0;
+	virtual IEventDispatcher<CoreEventHandler>& getEventDispatcher() = 0;
+	virtual IConfig& getConfig() = 0;
+	virtual void printLn(const char* fmt, ...) = 0;
+	virtual void setData(SettableCoreDataType type, StringView data) = 0;
+	virtual unsigned getTickCount() const = 0;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "types.hpp"
+
+/// The subset of the open.mp SDK's entity.hpp the gamemode uses.
+
+struct IIDProvider
+{
+	virtual int getID() const = 0;
+};
+
+struct IEntity : public IIDProvider
+{
+	virtual Vector3 getPosition() const = 0;
+	virtual void setPosition(Vector3 position) = 0;
+	virtual GTAQuat getRotation() const = 0;
+	virtual void setRotation(GTAQuat rotation) = 0;
+	virtual int getVirtualWorld() const = 0;
+	virtual void setVirtualWorld(int vw) = 0;
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// The subset of the open.mp SDK's events.hpp the gamemode uses.
+
+typedef int8_t event_order_t;
+
+enum EventPriority : event_order_t
+{
+	EventPriority_Highest = -128,
+	EventPriority_FairlyHigh = -64,
+	EventPriority_Default = 0,
+	EventPriority_FairlyLow = 64,
+	EventPriority_Lowest = 127,
+};
+
+template <class EventHandlerType>
+struct IEventDispatcher
+{
+	virtual bool addEventHandler(EventHandlerType* handler,
+		event_order_t priority = EventPriority_Default)
+		= 0;
+	virtual bool removeEventHandler(EventHandlerType* handler) = 0;
+	virtual bool hasEventHandler(
+		EventHandlerType* handler, event_order_t& priority)
+		= 0;
+	virtual std::size_t count() const = 0;
+};
+
+/// Handlers in priority order, the way the server's dispatchers call them
+template <class EventHandlerType>
+class DefaultEventDispatcher final
+	: public IEventDispatcher<EventHandlerType>
+{
+	struct Entry
+	{
+		EventHandlerType* handler;
+		event_order_t priority;
+	};
+	std::vector<Entry> handlers;
+
+public:
+	bool addEventHandler(EventHandlerType* handler,
+		event_order_t priority = EventPriority_Default) override
+	{
+		auto it = std::find_if(handlers.begin(), handlers.end(),
+			[priority](const Entry& entry)
+			{
+				return entry.priority > priority;
+			});
+		handlers.insert(it, Entry { handler, priority });
+		return true;
+	}
+
+	bool removeEventHandler(EventHandlerType* handler) override
+	{
+		auto it = std::find_if(handlers.begin(), handlers.end(),
+			[handler](const Entry& entry)
+			{
+				return entry.handler == handler;
+			});
+		if (it == handlers.end())
+			return false;
+		handlers.erase(it);
+		return true;
+	}
+
+	bool hasEventHandler(
+		EventHandlerType* handler, event_order_t& priority) override
+	{
+		for (const auto& entry : handlers)
+			if (entry.handler == handler)
+			{
+				priority = entry.priority;
+				return true;
+			}
+		return false;
+	}
+
+	std::size_t count() const override { return handlers.size(); }
+
+	template <typename Fn>
+	void dispatch(Fn fn)
+	{
+		// handlers may unsubscribe while they run
+		auto copy = handlers;
+		for (const auto& entry : copy)
+			fn(entry.handler);
+	}
+
+	/// Stops at the first handler returning false, like the server does
+	/// for the events that can be cancelled
+	template <typename Fn>
+	bool stopAtFalse(Fn fn)
+	{
+		auto copy = handlers;
+		for (const auto& entry : copy)
+			if (!fn(entry.handler))
+				return false;
+		return true;
+	}
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cstdio>
+
+/// The subset of the open.mp SDK's network.hpp the gamemode uses.
+
+enum PeerDisconnectReason
+{
+	PeerDisconnectReason_Timeout,
+	PeerDisconnectReason_Quit,
+	PeerDisconnectReason_Kicked,
+};
+
+struct PeerAddress
+{
+	using AddressString = StaticArray<char, 46>;
+
+	bool ipv6 = false;
+	uint32_t v4 = 0;
+
+	static bool ToString(const PeerAddress& in, AddressString& address)
+	{
+		std::snprintf(address.data(), address.size(), "%u.%u.%u.%u",
+			in.v4 & 0xFF, (in.v4 >> 8) & 0xFF, (in.v4 >> 16) & 0xFF,
+			in.v4 >> 24);
+		return true;
+	}
+};
+
+struct NetworkID
+{
+	PeerAddress address;
+	unsigned short port = 0;
+};
+
+struct PeerNetworkData
+{
+	NetworkID networkID;
+};
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "component.hpp"
+#include "entity.hpp"
+#include "events.hpp"
+#include "network.hpp"
+#include "pool.hpp"
+#include "types.hpp"
+#include "values.hpp"
+
+/// The subset of the open.mp SDK's player.hpp the gamemode uses.
+
+typedef StaticArray<WeaponSlotData, MAX_WEAPON_SLOTS> WeaponSlots;
+
+namespace Key
+{
+enum
+{
+	ACTION = 1,
+	CROUCH = 2,
+	FIRE = 4,
+	SPRINT = 8,
+	SECONDARY_ATTACK = 16,
+	JUMP = 32,
+	LOOK_RIGHT = 64,
+	HANDBRAKE = 128,
+	AIM = HANDBRAKE,
+	LOOK_LEFT = 256,
+	LOOK_BEHIND = 512,
+	WALK = 1024,
+	YES = 65536,
+	NO = 131072,
+	CTRL_BACK = 262144,
+};
+}
+
+enum PlayerState
+{
+	PlayerState_None = 0,
+	PlayerState_OnFoot = 1,
+	PlayerState_Driver = 2,
+	PlayerState_Passenger = 3,
+	PlayerState_ExitVehicle = 4,
+	PlayerState_EnterVehicleDriver = 5,
+	PlayerState_EnterVehiclePassenger = 6,
+	PlayerState_Wasted = 7,
+	PlayerState_Spawned = 8,
+	PlayerState_Spectating = 9,
+};
+
+enum PlayerCameraCutType
+{
+	PlayerCameraCutType_Cut,
+	PlayerCameraCutType_Move,
+};
+
+enum PlayerWeapon
+{
+	PlayerWeapon_Fist,
+	PlayerWeapon_BrassKnuckle,
+	PlayerWeapon_GolfClub,
+	PlayerWeapon_NiteStick,
+	PlayerWeapon_Knife,
+	PlayerWeapon_Bat,
+	PlayerWeapon_Shovel,
+	PlayerWeapon_PoolStick,
+	PlayerWeapon_Katana,
+	PlayerWeapon_Chainsaw,
+	PlayerWeapon_Dildo,
+	PlayerWeapon_Dildo2,
+	PlayerWeapon_Vibrator,
+	PlayerWeapon_Vibrator2,
+	PlayerWeapon_Flower,
+	PlayerWeapon_Cane,
+	PlayerWeapon_Grenade,
+	PlayerWeapon_Teargas,
+	PlayerWeapon_Moltov,
+	PlayerWeapon_Colt45 = 22,
+	PlayerWeapon_Silenced,
+	PlayerWeapon_Deagle,
+	PlayerWeapon_Shotgun,
+	PlayerWeapon_Sawedoff,
+	PlayerWeapon_Shotgspa,
+	PlayerWeapon_UZI,
+	PlayerWeapon_MP5,
+	PlayerWeapon_AK47,
+	PlayerWeapon_M4,
+	PlayerWeapon_TEC9,
+	PlayerWeapon_Rifle,
+	PlayerWeapon_Sniper,
+	PlayerWeapon_RocketLauncher,
+	PlayerWeapon_HeatSeeker,
+	PlayerWeapon_FlameThrower,
+	PlayerWeapon_Minigun,
+	PlayerWeapon_End
+};
+
+enum BodyPart
+{
+	BodyPart_Torso = 3,
+	BodyPart_Groin,
+	BodyPart_LeftArm,
+	BodyPart_RightArm,
+	BodyPart_LeftLeg,
+	BodyPart_RightLeg,
+	BodyPart_Head,
+};
+
+struct IPlayer : public IExtensible, public IEntity
+{
+	virtual void kick() = 0;
+	virtual void ban(StringView reason = StringView()) = 0;
+	virtual const PeerNetworkData& getNetworkData() const = 0;
+
+	virtual StringView getName() const = 0;
+	virtual Colour getColour() const = 0;
+	virtual void setColour(Colour colour) = 0;
+	virtual PlayerState getState() const = 0;
+
+	virtual void spawn() = 0;
+	virtual void setSkin(int skin, bool send = true) = 0;
+	virtual int getSkin() const = 0;
+	virtual void setHealth(float health) = 0;
+	virtual float getHealth() const = 0;
+	virtual void setArmour(float armour) = 0;
+	virtual float getArmour() const = 0;
+	virtual void setInterior(unsigned interior) = 0;
+	virtual unsigned getInterior() const = 0;
+	virtual void setWantedLevel(unsigned level) = 0;
+	virtual void setControllable(bool controllable) = 0;
+	virtual void setSpectating(bool spectating) = 0;
+
+	virtual void giveWeapon(WeaponSlotData weapon) = 0;
+	virtual void resetWeapons() = 0;
+	virtual void setArmedWeapon(uint32_t weapon) = 0;
+	virtual WeaponSlotData getArmedWeapon() const = 0;
+
+	virtual void removeFromVehicle(bool force) = 0;
+
+	virtual void setCameraPosition(Vector3 pos) = 0;
+	virtual void setCameraLookAt(Vector3 pos, int cutType) = 0;
+	virtual void setCameraBehind() = 0;
+	virtual void interpolateCameraPosition(Vector3 from, Vector3 to,
+		int time, PlayerCameraCutType cutType)
+		= 0;
+	virtual void interpolateCameraLookAt(Vector3 from, Vector3 to, int time,
+		PlayerCameraCutType cutType)
+		= 0;
+
+	virtual void sendClientMessage(const Colour& colour, StringView message)
+		= 0;
+	virtual void sendGameText(StringView message, Milliseconds time, int style)
+		= 0;
+	virtual void setChatBubble(StringView text, const Colour& colour,
+		float drawDist, Milliseconds expire)
+		= 0;
+	virtual void playSound(uint32_t sound, Vector3 pos) = 0;
+	virtual void sendDeathMessage(
+		IPlayer& player, IPlayer* killer, int weapon)
+		= 0;
+};
+
+struct PlayerConnectEventHandler
+{
+	virtual void onIncomingConnection(
+		IPlayer& player, StringView ipAddress, unsigned short port)
+	{
+	}
+	virtual void onPlayerConnect(IPlayer& player) { }
+	virtual void onPlayerDisconnect(
+		IPlayer& player, PeerDisconnectReason reason)
+	{
+	}
+	virtual void onPlayerClientInit(IPlayer& player) { }
+};
+
+struct PlayerSpawnEventHandler
+{
+	virtual bool onPlayerRequestSpawn(IPlayer& player) { return true; }
+	virtual void onPlayerSpawn(IPlayer& player) { }
+};
+
+struct PlayerTextEventHandler
+{
+	virtual bool onPlayerText(IPlayer& player, StringView message)
+	{
+		return true;
+	}
+	virtual bool onPlayerCommandText(IPlayer& player, StringView message)
+	{
+		return false;
+	}
+};
+
+struct PlayerChangeEventHandler
+{
+	virtual void onPlayerScoreChange(IPlayer& player, int score) { }
+	virtual void onPlayerNameChange(IPlayer& player, StringView oldName) { }
+	virtual void onPlayerInteriorChange(
+		IPlayer& player, unsigned newInterior, unsigned oldInterior)
+	{
+	}
+	virtual void onPlayerStateChange(
+		IPlayer& player, PlayerState newState, PlayerState oldState)
+	{
+	}
+	virtual void onPlayerKeyStateChange(
+		IPlayer& player, uint32_t newKeys, uint32_t oldKeys)
+	{
+	}
+};
+
+struct PlayerDamageEventHandler
+{
+	virtual void onPlayerDeath(IPlayer& player, IPlayer* killer, int reason)
+	{
+	}
+	virtual void onPlayerTakeDamage(IPlayer& player, IPlayer* from,
+		float amount, unsigned weapon, BodyPart part)
+	{
+	}
+	virtual void onPlayerGiveDamage(IPlayer& player, IPlayer& to, float amount,
+		unsigned weapon, BodyPart part)
+	{
+	}
+};
+
+struct IPlayerPool : public IExtensible, public IReadOnlyPool<IPlayer>
+{
+	virtual const FlatPtrHashSet<IPlayer>& entries() = 0;
+	virtual const FlatPtrHashSet<IPlayer>& players() = 0;
+	virtual const FlatPtrHashSet<IPlayer>& bots() = 0;
+
+	virtual IEventDispatcher<PlayerSpawnEventHandler>&
+	getPlayerSpawnDispatcher() = 0;
+	virtual IEventDispatcher<PlayerConnectEventHandler>&
+	getPlayerConnectDispatcher() = 0;
+	virtual IEventDispatcher<PlayerTextEventHandler>&
+	getPlayerTextDispatcher() = 0;
+	virtual IEventDispatcher<PlayerChangeEventHandler>&
+	getPlayerChangeDispatcher() = 0;
+	virtual IEventDispatcher<PlayerDamageEventHandler>&
+	getPlayerDamageDispatcher() = 0;
+
+	virtual void sendClientMessageToAll(
+		const Colour& colour, StringView message)
+		= 0;
+	virtual void sendDeathMessageToAll(IPlayer* killer, IPlayer& killee,
+		int weapon)
+		= 0;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "types.hpp"
+
+/// The subset of the open.mp SDK's pool.hpp the gamemode uses.
+
+template <typename T>
+struct IReadOnlyPool
+{
+	virtual T* get(int index) = 0;
+	virtual Pair<size_t, size_t> bounds() const = 0;
+};
+
+template <typename T>
+struct IPool : IReadOnlyPool<T>
+{
+	virtual void release(int index) = 0;
+	virtual size_t count() = 0;
+};
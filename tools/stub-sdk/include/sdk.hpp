@@ -0,0 +1,13 @@
+#pragma once
+
+/// Stand-in for the open.mp SDK, see tools/stub-sdk/README.md
+
+#include "component.hpp"
+#include "core.hpp"
+#include "entity.hpp"
+#include "events.hpp"
+#include "network.hpp"
+#include "player.hpp"
+#include "pool.hpp"
+#include "types.hpp"
+#include "values.hpp"
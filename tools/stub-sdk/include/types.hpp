@@ -0,0 +1,216 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/// The subset of the open.mp SDK's types.hpp the gamemode uses. Names and
+/// signatures follow the SDK so the gamemode compiles against either.
+
+namespace glm
+{
+struct vec2
+{
+	float x = 0, y = 0;
+	vec2() = default;
+	vec2(float x, float y)
+		: x(x)
+		, y(y)
+	{
+	}
+};
+
+struct vec4;
+
+struct vec3
+{
+	float x = 0, y = 0, z = 0;
+	vec3() = default;
+	vec3(float x, float y, float z)
+		: x(x)
+		, y(y)
+		, z(z)
+	{
+	}
+	explicit vec3(const vec4& v);
+
+	vec3 operator+(const vec3& o) const
+	{
+		return { x + o.x, y + o.y, z + o.z };
+	}
+	vec3 operator-(const vec3& o) const
+	{
+		return { x - o.x, y - o.y, z - o.z };
+	}
+	bool operator==(const vec3&) const = default;
+};
+
+struct vec4
+{
+	float x = 0, y = 0, z = 0, w = 0;
+	vec4() = default;
+	vec4(float x, float y, float z, float w)
+		: x(x)
+		, y(y)
+		, z(z)
+		, w(w)
+	{
+	}
+	vec4(const vec3& v, float w)
+		: x(v.x)
+		, y(v.y)
+		, z(v.z)
+		, w(w)
+	{
+	}
+};
+
+inline vec3::vec3(const vec4& v)
+	: x(v.x)
+	, y(v.y)
+	, z(v.z)
+{
+}
+
+inline float length(const vec3& v)
+{
+	return std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+}
+
+inline float distance(const vec3& a, const vec3& b) { return length(a - b); }
+}
+
+typedef glm::vec2 Vector2;
+typedef glm::vec3 Vector3;
+typedef glm::vec4 Vector4;
+
+struct GTAQuat
+{
+	float w = 1, x = 0, y = 0, z = 0;
+	GTAQuat() = default;
+	GTAQuat(float w, float x, float y, float z)
+		: w(w)
+		, x(x)
+		, y(y)
+		, z(z)
+	{
+	}
+	/// Euler angles in degrees
+	GTAQuat(Vector3 euler)
+		: z(euler.z)
+	{
+	}
+	Vector3 ToEuler() const { return Vector3(0, 0, z); }
+};
+
+typedef std::chrono::steady_clock::time_point TimePoint;
+typedef std::chrono::microseconds Microseconds;
+typedef std::chrono::milliseconds Milliseconds;
+typedef std::chrono::seconds Seconds;
+typedef std::chrono::minutes Minutes;
+
+template <typename T>
+using DynamicArray = std::vector<T>;
+template <typename T, std::size_t N>
+using StaticArray = std::array<T, N>;
+template <typename A, typename B>
+using Pair = std::pair<A, B>;
+template <typename T>
+using FlatPtrHashSet = std::unordered_set<T*>;
+
+struct StringView : std::string_view
+{
+	using std::string_view::string_view;
+	constexpr StringView() = default;
+	constexpr StringView(std::string_view view)
+		: std::string_view(view)
+	{
+	}
+	StringView(const std::string& string)
+		: std::string_view(string)
+	{
+	}
+	std::string to_string() const { return std::string(data(), size()); }
+};
+
+struct Colour
+{
+	uint8_t r = 0, g = 0, b = 0, a = 0;
+
+	Colour() = default;
+	constexpr Colour(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+		: r(r)
+		, g(g)
+		, b(b)
+		, a(a)
+	{
+	}
+
+	uint32_t RGBA() const
+	{
+		return (uint32_t(r) << 24) | (uint32_t(g) << 16) | (uint32_t(b) << 8)
+			| uint32_t(a);
+	}
+	uint32_t ARGB() const { return (RGBA() >> 8) | (uint32_t(a) << 24); }
+
+	static Colour FromRGBA(uint32_t rgba)
+	{
+		return Colour(rgba >> 24, rgba >> 16, rgba >> 8, rgba);
+	}
+	static Colour FromARGB(uint32_t argb)
+	{
+		return Colour(argb >> 16, argb >> 8, argb, argb >> 24);
+	}
+
+	static Colour None() { return Colour(0, 0, 0, 0); }
+	static Colour White() { return Colour(255, 255, 255); }
+	static Colour Black() { return Colour(0, 0, 0); }
+	static Colour Red() { return Colour(255, 0, 0); }
+	static Colour Green() { return Colour(0, 255, 0); }
+	static Colour Yellow() { return Colour(255, 255, 0); }
+	static Colour Cyan() { return Colour(0, 255, 255); }
+
+	bool operator==(const Colour&) const = default;
+};
+
+struct WeaponSlotData
+{
+	uint8_t id;
+	uint32_t ammo;
+
+	WeaponSlotData()
+		: id(0)
+		, ammo(0)
+	{
+	}
+	WeaponSlotData(uint8_t id, uint32_t ammo = 0)
+		: id(id)
+		, ammo(ammo)
+	{
+	}
+};
+
+struct SemanticVersion
+{
+	uint8_t major, minor, patch;
+	uint16_t prerel;
+
+	SemanticVersion(uint8_t major, uint8_t minor, uint8_t patch,
+		uint16_t prerel = 0)
+		: major(major)
+		, minor(minor)
+		, patch(patch)
+		, prerel(prerel)
+	{
+	}
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+/// The subset of the open.mp SDK's values.hpp the gamemode uses.
+
+constexpr int INVALID_PLAYER_ID = 0xFFFF;
+constexpr int INVALID_VEHICLE_ID = 0xFFFF;
+constexpr int INVALID_TEXTDRAW = 0xFFFF;
+constexpr int INVALID_DIALOG_ID = -1;
+constexpr int PLAYER_POOL_SIZE = 1000;
+constexpr int VEHICLE_POOL_SIZE = 2000;
+constexpr int MAX_WEAPON_SLOTS = 13;
+constexpr int TEAM_NONE = 255;
+constexpr int MAX_VEHICLE_MODELS = 212;
@@ -0,0 +1,276 @@
+#include "Components.hpp"
+#include "Player.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Stub
+{
+Milliseconds Timer::remaining() const
+{
+	return std::max(Milliseconds(0),
+		std::chrono::duration_cast<Milliseconds>(
+			this->due - std::chrono::steady_clock::now()));
+}
+
+TimersComponent::~TimersComponent()
+{
+	this->running.clear();
+	this->handles.clear();
+}
+
+ITimer* TimersComponent::create(
+	TimerTimeOutHandler* handler, Milliseconds interval, bool repeating)
+{
+	auto timer = std::make_unique<Timer>(
+		handler, interval, repeating, std::chrono::steady_clock::now());
+	auto handle = timer.get();
+	this->running.push_back(std::move(timer));
+	this->handles.insert(handle);
+	return handle;
+}
+
+void TimersComponent::onTick(Microseconds elapsed, TimePoint now)
+{
+	// handlers may create timers, only the ones that existed before the
+	// tick are looked at
+	const auto count = this->running.size();
+	for (std::size_t i = 0; i < count; i++)
+	{
+		auto timer = this->running[i].get();
+		if (!timer->running() || timer->due > now)
+			continue;
+		if (timer->repeating())
+			timer->due = now + timer->interval();
+		else
+			timer->kill();
+		timer->trigger();
+	}
+
+	auto killed = std::remove_if(this->running.begin(), this->running.end(),
+		[this](const std::unique_ptr<Timer>& timer)
+		{
+			if (timer->running())
+				return false;
+			this->handles.erase(timer.get());
+			return true;
+		});
+	this->running.erase(killed, this->running.end());
+}
+
+void PlayerDialogData::show(IPlayer& player, int id, DialogStyle style,
+	StringView title, StringView body, StringView button1, StringView button2)
+{
+	this->activeId = id;
+	this->style = style;
+	this->title = title.to_string();
+	this->body = body.to_string();
+	this->button1 = button1.to_string();
+	this->button2 = button2.to_string();
+	this->shown++;
+}
+
+void PlayerDialogData::get(int& id, DialogStyle& style, StringView& title,
+	StringView& body, StringView& button1, StringView& button2)
+{
+	id = this->activeId;
+	style = this->style;
+	title = this->title;
+	body = this->body;
+	button1 = this->button1;
+	button2 = this->button2;
+}
+
+DialogsComponent::DialogsComponent(PlayerPool& playerPool)
+	: playerPool(playerPool)
+{
+	playerPool.getPlayerConnectDispatcher().addEventHandler(
+		this, EventPriority_Highest);
+}
+
+DialogsComponent::~DialogsComponent()
+{
+	playerPool.getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+bool DialogsComponent::respond(IPlayer& player, DialogResponse response,
+	int listItem, StringView inputText)
+{
+	auto data = ::queryExtension<PlayerDialogData>(player);
+	if (!data || data->activeId == INVALID_DIALOG_ID)
+		return false;
+	auto dialogId = data->activeId;
+	data->activeId = INVALID_DIALOG_ID;
+	// the handlers usually show the next dialog, which overwrites the data
+	auto text = inputText.to_string();
+	this->dispatcher.dispatch(
+		[&](PlayerDialogEventHandler* handler)
+		{
+			handler->onDialogResponse(
+				player, dialogId, response, listItem, text);
+		});
+	return true;
+}
+
+void DialogsComponent::onPlayerConnect(IPlayer& player)
+{
+	player.addExtension(new PlayerDialogData(), true);
+}
+
+TextDrawsComponent::TextDrawsComponent(PlayerPool& playerPool)
+	: playerPool(playerPool)
+{
+	playerPool.getPlayerConnectDispatcher().addEventHandler(
+		this, EventPriority_Highest);
+}
+
+TextDrawsComponent::~TextDrawsComponent()
+{
+	playerPool.getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+void TextDrawsComponent::onPlayerConnect(IPlayer& player)
+{
+	player.addExtension(new PlayerTextDrawData(), true);
+}
+
+ClassesComponent::ClassesComponent(PlayerPool& playerPool)
+	: playerPool(playerPool)
+{
+	playerPool.getPlayerConnectDispatcher().addEventHandler(
+		this, EventPriority_Highest);
+}
+
+ClassesComponent::~ClassesComponent()
+{
+	playerPool.getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+bool ClassesComponent::requestClass(IPlayer& player, unsigned int classId)
+{
+	if (auto playerClass = this->find(classId))
+		::queryExtension<IPlayerClassData>(player)->setSpawnInfo(
+			playerClass->getClass());
+	return this->dispatcher.stopAtFalse(
+		[&](ClassEventHandler* handler)
+		{
+			return handler->onPlayerRequestClass(player, classId);
+		});
+}
+
+void ClassesComponent::onPlayerConnect(IPlayer& player)
+{
+	player.addExtension(new PlayerClassData(), true);
+}
+
+Vehicle::Vehicle(int id, VehiclesComponent& owner, const VehicleSpawnData& data)
+	: id(id)
+	, owner(owner)
+	, spawnData(data)
+	, position(data.position)
+	, rotation(Vector3(0.0, 0.0, data.zRotation))
+	, virtualWorld(0)
+{
+}
+
+void Vehicle::putPlayer(IPlayer& player, int seatID)
+{
+	this->owner.enter(player, *this);
+}
+
+void Vehicle::respawn() { this->owner.respawn(*this); }
+
+VehiclesComponent::VehiclesComponent(PlayerPool& playerPool)
+	: playerPool(playerPool)
+{
+	playerPool.getPlayerConnectDispatcher().addEventHandler(
+		this, EventPriority_Highest);
+}
+
+VehiclesComponent::~VehiclesComponent()
+{
+	playerPool.getPlayerConnectDispatcher().removeEventHandler(this);
+}
+
+IVehicle* VehiclesComponent::create(bool isStatic, int modelID,
+	Vector3 position, float Z, int colour1, int colour2, Seconds respawnDelay,
+	bool addSiren)
+{
+	return this->create(VehicleSpawnData { .respawnDelay = respawnDelay,
+		.modelID = modelID,
+		.position = position,
+		.zRotation = Z,
+		.colour1 = colour1,
+		.colour2 = colour2,
+		.siren = addSiren });
+}
+
+void VehiclesComponent::release(int index)
+{
+	auto vehicle = static_cast<Vehicle*>(this->find(index));
+	if (!vehicle)
+		return;
+	if (auto driver = vehicle->getDriver())
+		this->exit(*driver);
+	this->erase(index);
+}
+
+void VehiclesComponent::enter(IPlayer& player, Vehicle& vehicle)
+{
+	this->exit(player);
+	if (auto driver = vehicle.getDriver())
+		this->exit(*driver);
+	::queryExtension<PlayerVehicleData>(player)->vehicle = &vehicle;
+	vehicle.setDriver(&player);
+	player.setPosition(vehicle.getPosition());
+	static_cast<Player&>(player).setState(PlayerState_Driver);
+	this->dispatcher.dispatch(
+		[&](VehicleEventHandler* handler)
+		{
+			handler->onPlayerEnterVehicle(player, vehicle, false);
+		});
+}
+
+void VehiclesComponent::exit(IPlayer& player)
+{
+	auto data = ::queryExtension<PlayerVehicleData>(player);
+	if (!data || !data->vehicle)
+		return;
+	auto vehicle = data->vehicle;
+	data->vehicle = nullptr;
+	vehicle->setDriver(nullptr);
+	static_cast<Player&>(player).setState(PlayerState_OnFoot);
+	this->dispatcher.dispatch(
+		[&](VehicleEventHandler* handler)
+		{
+			handler->onPlayerExitVehicle(player, *vehicle);
+		});
+}
+
+void VehiclesComponent::respawn(Vehicle& vehicle)
+{
+	if (auto driver = vehicle.getDriver())
+		this->exit(*driver);
+	VehicleSpawnData data;
+	vehicle.getSpawnData(data);
+	vehicle.setPosition(data.position);
+	vehicle.setRotation(GTAQuat(Vector3(0.0, 0.0, data.zRotation)));
+	vehicle.setVelocity(Vector3());
+	this->dispatcher.dispatch(
+		[&](VehicleEventHandler* handler)
+		{
+			handler->onVehicleSpawn(vehicle);
+		});
+}
+
+void VehiclesComponent::onPlayerConnect(IPlayer& player)
+{
+	player.addExtension(new PlayerVehicleData(), true);
+}
+
+void VehiclesComponent::onPlayerDisconnect(
+	IPlayer& player, PeerDisconnectReason reason)
+{
+	this->exit(player);
+}
+}
@@ -0,0 +1,450 @@
+#pragma once
+
+#include <Server/Components/Classes/classes.hpp>
+#include <Server/Components/Dialogs/dialogs.hpp>
+#include <Server/Components/TextDraws/textdraws.hpp>
+#include <Server/Components/Timers/timers.hpp>
+#include <Server/Components/Vehicles/vehicles.hpp>
+#include <core.hpp>
+#include <player.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/// The server components the gamemode queries, without the network. Each
+/// one adds its player data in onPlayerConnect like the real components do.
+namespace Stub
+{
+class PlayerPool;
+
+/// Pools hand out the lowest free id, like the server's
+template <typename Interface, typename Entry>
+class EntryPool
+{
+protected:
+	std::vector<std::unique_ptr<Entry>> entries;
+
+	template <typename... Args>
+	Entry* emplace(Args&&... args)
+	{
+		std::size_t id = 0;
+		while (id < this->entries.size() && this->entries[id])
+			id++;
+		if (id == this->entries.size())
+			this->entries.emplace_back();
+		this->entries[id]
+			= std::make_unique<Entry>(int(id), std::forward<Args>(args)...);
+		return this->entries[id].get();
+	}
+
+	Interface* find(int index)
+	{
+		if (index < 0 || std::size_t(index) >= this->entries.size())
+			return nullptr;
+		return this->entries[index].get();
+	}
+
+	void erase(int index)
+	{
+		if (index >= 0 && std::size_t(index) < this->entries.size())
+			this->entries[index].reset();
+	}
+
+	std::size_t size()
+	{
+		std::size_t count = 0;
+		for (const auto& entry : this->entries)
+			count += entry != nullptr;
+		return count;
+	}
+};
+
+/// Leaves the IExtensible part of a component empty
+template <typename ComponentT>
+struct Component : public ComponentT
+{
+	int supportedVersion() const override { return 0; }
+	SemanticVersion componentVersion() const override
+	{
+		return SemanticVersion(0, 0, 0);
+	}
+	void onLoad(ICore* c) override { }
+	void free() override { }
+	void reset() override { }
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+};
+
+class Timer final : public ITimer
+{
+	TimerTimeOutHandler* timeoutHandler;
+	Milliseconds timerInterval;
+	bool repeat;
+	bool alive = true;
+
+public:
+	TimePoint due;
+
+	Timer(TimerTimeOutHandler* handler, Milliseconds interval, bool repeating,
+		TimePoint now)
+		: timeoutHandler(handler)
+		, timerInterval(interval)
+		, repeat(repeating)
+		, due(now + interval)
+	{
+	}
+	~Timer() { this->timeoutHandler->free(); }
+
+	bool running() const override { return this->alive; }
+	Milliseconds remaining() const override;
+	bool repeating() const override { return this->repeat; }
+	Milliseconds interval() const override { return this->timerInterval; }
+	TimerTimeOutHandler* handler() const override
+	{
+		return this->timeoutHandler;
+	}
+	void kill() override { this->alive = false; }
+	void trigger() override { this->timeoutHandler->timeout(*this); }
+};
+
+/// Runs the timers that are due on every tick, like the server's component.
+/// Killed timers are freed once the tick is over, so a handler may kill its
+/// own timer.
+class TimersComponent final : public Component<ITimersComponent>,
+							  public CoreEventHandler
+{
+	std::vector<std::unique_ptr<Timer>> running;
+	FlatPtrHashSet<ITimer> handles;
+
+public:
+	~TimersComponent();
+
+	StringView componentName() const override { return "Timers"; }
+
+	ITimer* create(TimerTimeOutHandler* handler, Milliseconds interval,
+		bool repeating) override;
+	const FlatPtrHashSet<ITimer>& timers() const override
+	{
+		return this->handles;
+	}
+
+	void onTick(Microseconds elapsed, TimePoint now) override;
+};
+
+class PlayerDialogData final : public IPlayerDialogData
+{
+public:
+	int activeId = INVALID_DIALOG_ID;
+	DialogStyle style = DialogStyle_MSGBOX;
+	std::string title;
+	std::string body;
+	std::string button1;
+	std::string button2;
+	std::size_t shown = 0;
+
+	void hide(IPlayer& player) override { this->activeId = INVALID_DIALOG_ID; }
+	void show(IPlayer& player, int id, DialogStyle style, StringView title,
+		StringView body, StringView button1, StringView button2) override;
+	void get(int& id, DialogStyle& style, StringView& title, StringView& body,
+		StringView& button1, StringView& button2) override;
+	int getActiveID() const override { return this->activeId; }
+};
+
+class DialogsComponent final : public Component<IDialogsComponent>,
+							   public PlayerConnectEventHandler
+{
+	PlayerPool& playerPool;
+	DefaultEventDispatcher<PlayerDialogEventHandler> dispatcher;
+
+public:
+	explicit DialogsComponent(PlayerPool& playerPool);
+	~DialogsComponent();
+
+	StringView componentName() const override { return "Dialogs"; }
+	IEventDispatcher<PlayerDialogEventHandler>& getEventDispatcher() override
+	{
+		return this->dispatcher;
+	}
+
+	/// Answers the dialog the player is looking at, false if there is none
+	bool respond(IPlayer& player, DialogResponse response, int listItem = 0,
+		StringView inputText = StringView());
+
+	void onPlayerConnect(IPlayer& player) override;
+};
+
+class PlayerTextDraw final : public IPlayerTextDraw
+{
+	int id;
+	Vector2 position;
+	std::string text;
+	bool visible = false;
+
+public:
+	PlayerTextDraw(int id, Vector2 position, StringView text)
+		: id(id)
+		, position(position)
+		, text(text.to_string())
+	{
+	}
+
+	int getID() const override { return this->id; }
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+
+	Vector2 getPosition() const override { return this->position; }
+	ITextDrawBase& setPosition(Vector2 position) override
+	{
+		this->position = position;
+		return *this;
+	}
+	void setText(StringView text) override { this->text = text.to_string(); }
+	StringView getText() const override { return this->text; }
+	ITextDrawBase& setLetterSize(Vector2 size) override { return *this; }
+	ITextDrawBase& setTextSize(Vector2 size) override { return *this; }
+	ITextDrawBase& setAlignment(TextDrawAlignmentTypes alignment) override
+	{
+		return *this;
+	}
+	ITextDrawBase& setColour(Colour colour) override { return *this; }
+	ITextDrawBase& useBox(bool use) override { return *this; }
+	ITextDrawBase& setBoxColour(Colour colour) override { return *this; }
+	ITextDrawBase& setShadow(int shadow) override { return *this; }
+	ITextDrawBase& setOutline(int outline) override { return *this; }
+	ITextDrawBase& setBackgroundColour(Colour colour) override
+	{
+		return *this;
+	}
+	ITextDrawBase& setStyle(TextDrawStyle style) override { return *this; }
+	ITextDrawBase& setProportional(bool proportional) override
+	{
+		return *this;
+	}
+	ITextDrawBase& setSelectable(bool selectable) override { return *this; }
+
+	void show() override { this->visible = true; }
+	void hide() override { this->visible = false; }
+	bool isShown() const override { return this->visible; }
+};
+
+class PlayerTextDrawData final
+	: public IPlayerTextDrawData,
+	  private EntryPool<IPlayerTextDraw, PlayerTextDraw>
+{
+public:
+	IPlayerTextDraw* create(Vector2 position, StringView text) override
+	{
+		return this->emplace(position, text);
+	}
+	IPlayerTextDraw* create(Vector2 position, int model) override
+	{
+		return this->emplace(position, StringView());
+	}
+	IPlayerTextDraw* get(int index) override { return this->find(index); }
+	Pair<size_t, size_t> bounds() const override
+	{
+		return { 0, this->entries.size() };
+	}
+	void release(int index) override { this->erase(index); }
+	size_t count() override { return this->size(); }
+};
+
+/// The gamemode only uses per-player textdraws, so this just hands out
+/// their pools
+class TextDrawsComponent final : public PlayerConnectEventHandler
+{
+	PlayerPool& playerPool;
+
+public:
+	explicit TextDrawsComponent(PlayerPool& playerPool);
+	~TextDrawsComponent();
+
+	void onPlayerConnect(IPlayer& player) override;
+};
+
+class Class final : public IClass
+{
+	int id;
+	PlayerClass data;
+
+public:
+	Class(int id, const PlayerClass& data)
+		: id(id)
+		, data(data)
+	{
+	}
+
+	int getID() const override { return this->id; }
+	PlayerClass& getClass() override { return this->data; }
+	void setClass(const PlayerClass& data) override { this->data = data; }
+};
+
+class PlayerClassData final : public IPlayerClassData
+{
+public:
+	PlayerClass spawnInfo = PlayerClass(
+		0, TEAM_NONE, Vector3(0.0, 0.0, 3.0), 0.0, WeaponSlots {});
+
+	const PlayerClass& getClass() override { return this->spawnInfo; }
+	void setSpawnInfo(const PlayerClass& info) override
+	{
+		this->spawnInfo = info;
+	}
+	void spawnPlayer() override { }
+};
+
+class ClassesComponent final : public Component<IClassesComponent>,
+							   public PlayerConnectEventHandler,
+							   private EntryPool<IClass, Class>
+{
+	PlayerPool& playerPool;
+	DefaultEventDispatcher<ClassEventHandler> dispatcher;
+
+public:
+	explicit ClassesComponent(PlayerPool& playerPool);
+	~ClassesComponent();
+
+	StringView componentName() const override { return "Classes"; }
+	IEventDispatcher<ClassEventHandler>& getEventDispatcher() override
+	{
+		return this->dispatcher;
+	}
+
+	IClass* create(int skin, int team, Vector3 spawn, float angle,
+		const WeaponSlots& weapons) override
+	{
+		return this->emplace(PlayerClass(skin, team, spawn, angle, weapons));
+	}
+	IClass* get(int index) override { return this->find(index); }
+	Pair<size_t, size_t> bounds() const override
+	{
+		return { 0, this->entries.size() };
+	}
+	void release(int index) override { this->erase(index); }
+	size_t count() override { return this->size(); }
+
+	/// The player looking at a class in the selection screen
+	bool requestClass(IPlayer& player, unsigned int classId);
+
+	void onPlayerConnect(IPlayer& player) override;
+};
+
+class VehiclesComponent;
+
+class Vehicle final : public IVehicle
+{
+	int id;
+	VehiclesComponent& owner;
+	VehicleSpawnData spawnData;
+	Vector3 position;
+	GTAQuat rotation;
+	Vector3 velocity;
+	int virtualWorld = 0;
+	std::string plate;
+	IPlayer* driver = nullptr;
+
+public:
+	Vehicle(int id, VehiclesComponent& owner, const VehicleSpawnData& data);
+
+	VehiclesComponent& getOwner() { return this->owner; }
+	void setDriver(IPlayer* driver) { this->driver = driver; }
+
+	int getID() const override { return this->id; }
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+
+	Vector3 getPosition() const override { return this->position; }
+	void setPosition(Vector3 position) override { this->position = position; }
+	GTAQuat getRotation() const override { return this->rotation; }
+	void setRotation(GTAQuat rotation) override { this->rotation = rotation; }
+	int getVirtualWorld() const override { return this->virtualWorld; }
+	void setVirtualWorld(int vw) override { this->virtualWorld = vw; }
+
+	void setSpawnData(const VehicleSpawnData& data) override
+	{
+		this->spawnData = data;
+	}
+	void getSpawnData(VehicleSpawnData& data) override
+	{
+		data = this->spawnData;
+	}
+	void putPlayer(IPlayer& player, int seatID) override;
+	void setPlate(StringView plate) override
+	{
+		this->plate = plate.to_string();
+	}
+	StringView getPlate() override { return this->plate; }
+	Vector3 getVelocity() override { return this->velocity; }
+	void setVelocity(Vector3 velocity) override { this->velocity = velocity; }
+	IPlayer* getDriver() override { return this->driver; }
+	int getModel() override { return this->spawnData.modelID; }
+	void respawn() override;
+};
+
+class PlayerVehicleData final : public IPlayerVehicleData
+{
+public:
+	Vehicle* vehicle = nullptr;
+
+	IVehicle* getVehicle() override { return this->vehicle; }
+	void resetVehicle() override { this->vehicle = nullptr; }
+	int getSeat() const override { return this->vehicle ? 0 : -1; }
+	bool isInModShop() const override { return false; }
+};
+
+class VehiclesComponent final : public Component<IVehiclesComponent>,
+								public PlayerConnectEventHandler,
+								private EntryPool<IVehicle, Vehicle>
+{
+	PlayerPool& playerPool;
+	DefaultEventDispatcher<VehicleEventHandler> dispatcher;
+
+public:
+	explicit VehiclesComponent(PlayerPool& playerPool);
+	~VehiclesComponent();
+
+	StringView componentName() const override { return "Vehicles"; }
+	IEventDispatcher<VehicleEventHandler>& getEventDispatcher() override
+	{
+		return this->dispatcher;
+	}
+
+	IVehicle* create(bool isStatic, int modelID, Vector3 position, float Z,
+		int colour1, int colour2, Seconds respawnDelay,
+		bool addSiren) override;
+	IVehicle* create(const VehicleSpawnData& data) override
+	{
+		return this->emplace(*this, data);
+	}
+	IVehicle* get(int index) override { return this->find(index); }
+	Pair<size_t, size_t> bounds() const override
+	{
+		return { 0, this->entries.size() };
+	}
+	void release(int index) override;
+	size_t count() override { return this->size(); }
+
+	/// The player getting into the driver's seat
+	void enter(IPlayer& player, Vehicle& vehicle);
+	/// The player getting out of the vehicle they are driving
+	void exit(IPlayer& player);
+	void respawn(Vehicle& vehicle);
+
+	void onPlayerConnect(IPlayer& player) override;
+	void onPlayerDisconnect(
+		IPlayer& player, PeerDisconnectReason reason) override;
+};
+}
@@ -0,0 +1,244 @@
+#include "Player.hpp"
+#include "Components.hpp"
+
+namespace Stub
+{
+Player::Player(PlayerPool& pool, int id, std::string name)
+	: pool(pool)
+	, id(id)
+	, name(std::move(name))
+{
+	this->networkData.networkID.address.v4 = 0x0100007F;
+}
+
+Player::~Player() { this->freeExtensions(); }
+
+void Player::setState(PlayerState newState)
+{
+	auto oldState = this->state;
+	if (oldState == newState)
+		return;
+	this->state = newState;
+	this->pool.changeDispatcher.dispatch(
+		[&](PlayerChangeEventHandler* handler)
+		{
+			handler->onPlayerStateChange(*this, newState, oldState);
+		});
+}
+
+void Player::freeExtensions()
+{
+	auto extensions = std::move(this->extensions);
+	this->extensions.clear();
+	for (auto& [id, entry] : extensions)
+		if (entry.second)
+			entry.first->freeExtension();
+}
+
+IExtension* Player::getExtension(UID id)
+{
+	auto it = this->extensions.find(id);
+	return it == this->extensions.end() ? nullptr : it->second.first;
+}
+
+bool Player::addExtension(IExtension* extension, bool autoDeleteExt)
+{
+	return this->extensions
+		.try_emplace(extension->getExtensionID(), extension, autoDeleteExt)
+		.second;
+}
+
+bool Player::removeExtension(IExtension* extension)
+{
+	return this->extensions.erase(extension->getExtensionID()) > 0;
+}
+
+void Player::spawn()
+{
+	if (auto classData = ::queryExtension<IPlayerClassData>(*this))
+	{
+		const auto& spawnInfo = classData->getClass();
+		this->position = spawnInfo.spawn;
+		this->rotation = GTAQuat(Vector3(0.0, 0.0, spawnInfo.angle));
+		this->skin = spawnInfo.skin;
+		this->weapons = spawnInfo.weapons;
+	}
+	this->health = 100.0;
+	this->setState(PlayerState_Spawned);
+	this->pool.spawnDispatcher.dispatch(
+		[this](PlayerSpawnEventHandler* handler)
+		{
+			handler->onPlayerSpawn(*this);
+		});
+	this->setState(PlayerState_OnFoot);
+}
+
+void Player::setSpectating(bool spectating)
+{
+	if (spectating)
+		this->setState(PlayerState_Spectating);
+	else if (this->state == PlayerState_Spectating)
+		this->spawn();
+}
+
+void Player::giveWeapon(WeaponSlotData weapon)
+{
+	for (auto& slot : this->weapons)
+		if (slot.id == 0 || slot.id == weapon.id)
+		{
+			slot = weapon;
+			return;
+		}
+}
+
+void Player::resetWeapons()
+{
+	this->weapons = {};
+	this->armedWeapon = 0;
+}
+
+WeaponSlotData Player::getArmedWeapon() const
+{
+	for (const auto& slot : this->weapons)
+		if (slot.id == this->armedWeapon)
+			return slot;
+	return WeaponSlotData(this->armedWeapon);
+}
+
+void Player::removeFromVehicle(bool force)
+{
+	auto vehicleData = ::queryExtension<PlayerVehicleData>(*this);
+	if (vehicleData && vehicleData->vehicle)
+		vehicleData->vehicle->getOwner().exit(*this);
+}
+
+PlayerPool::PlayerPool()
+	: slots(PLAYER_POOL_SIZE)
+{
+}
+
+PlayerPool::~PlayerPool()
+{
+	for (auto& player : this->slots)
+		if (player)
+			this->disconnect(*player);
+}
+
+Player* PlayerPool::connect(const std::string& name)
+{
+	std::size_t id = 0;
+	while (id < this->slots.size() && this->slots[id])
+		id++;
+	if (id == this->slots.size())
+		return nullptr;
+
+	this->slots[id] = std::make_unique<Player>(*this, int(id), name);
+	auto player = this->slots[id].get();
+	this->connectDispatcher.dispatch(
+		[player](PlayerConnectEventHandler* handler)
+		{
+			handler->onIncomingConnection(*player, "127.0.0.1", 7777);
+		});
+	this->connected.insert(player);
+	this->connectDispatcher.dispatch(
+		[player](PlayerConnectEventHandler* handler)
+		{
+			handler->onPlayerConnect(*player);
+		});
+	this->connectDispatcher.dispatch(
+		[player](PlayerConnectEventHandler* handler)
+		{
+			handler->onPlayerClientInit(*player);
+		});
+	return player;
+}
+
+void PlayerPool::disconnect(Player& player, PeerDisconnectReason reason)
+{
+	const auto id = player.getID();
+	this->connectDispatcher.dispatch(
+		[&](PlayerConnectEventHandler* handler)
+		{
+			handler->onPlayerDisconnect(player, reason);
+		});
+	this->connected.erase(&player);
+	this->slots[id].reset();
+}
+
+bool PlayerPool::text(Player& player, StringView message)
+{
+	return this->textDispatcher.stopAtFalse(
+		[&](PlayerTextEventHandler* handler)
+		{
+			return handler->onPlayerText(player, message);
+		});
+}
+
+bool PlayerPool::command(Player& player, StringView command)
+{
+	// the first handler that knows the command ends the search
+	return !this->textDispatcher.stopAtFalse(
+		[&](PlayerTextEventHandler* handler)
+		{
+			return !handler->onPlayerCommandText(player, command);
+		});
+}
+
+bool PlayerPool::requestSpawn(Player& player)
+{
+	return this->spawnDispatcher.stopAtFalse(
+		[&](PlayerSpawnEventHandler* handler)
+		{
+			return handler->onPlayerRequestSpawn(player);
+		});
+}
+
+void PlayerPool::kill(Player& player, Player* killer, int weapon)
+{
+	player.removeFromVehicle(true);
+	player.setState(PlayerState_Wasted);
+	this->damageDispatcher.dispatch(
+		[&](PlayerDamageEventHandler* handler)
+		{
+			handler->onPlayerDeath(player, killer, weapon);
+		});
+}
+
+void PlayerPool::damage(
+	Player& player, Player& from, float amount, unsigned weapon, BodyPart part)
+{
+	this->damageDispatcher.dispatch(
+		[&](PlayerDamageEventHandler* handler)
+		{
+			handler->onPlayerGiveDamage(from, player, amount, weapon, part);
+		});
+	this->damageDispatcher.dispatch(
+		[&](PlayerDamageEventHandler* handler)
+		{
+			handler->onPlayerTakeDamage(player, &from, amount, weapon, part);
+		});
+}
+
+void PlayerPool::keys(Player& player, uint32_t newKeys, uint32_t oldKeys)
+{
+	this->changeDispatcher.dispatch(
+		[&](PlayerChangeEventHandler* handler)
+		{
+			handler->onPlayerKeyStateChange(player, newKeys, oldKeys);
+		});
+}
+
+IPlayer* PlayerPool::get(int index)
+{
+	if (index < 0 || std::size_t(index) >= this->slots.size())
+		return nullptr;
+	return this->slots[index].get();
+}
+
+void PlayerPool::sendClientMessageToAll(
+	const Colour& colour, StringView message)
+{
+	for (auto player : this->connected)
+		player->sendClientMessage(colour, message);
+}
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <player.hpp>
+#include <sdk.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Stub
+{
+class PlayerPool;
+
+/// A connected player with no client behind it. It keeps whatever the
+/// gamemode sets on it and counts what would have been sent to the client.
+class Player final : public IPlayer
+{
+	PlayerPool& pool;
+	int id;
+	std::string name;
+	PeerNetworkData networkData;
+	std::unordered_map<UID, std::pair<IExtension*, bool>> extensions;
+
+	Vector3 position;
+	GTAQuat rotation;
+	int virtualWorld = 0;
+	Colour colour;
+	PlayerState state = PlayerState_None;
+	int skin = 0;
+	float health = 100.0;
+	float armour = 0.0;
+	unsigned interior = 0;
+	WeaponSlots weapons;
+	uint32_t armedWeapon = 0;
+	bool kicked = false;
+
+public:
+	/// what the gamemode sent to the client
+	std::size_t messages = 0;
+	std::size_t messageBytes = 0;
+	std::size_t gameTexts = 0;
+
+	Player(PlayerPool& pool, int id, std::string name);
+	~Player();
+
+	/// Moves the player to a state the way the server does after a client
+	/// packet, telling the change handlers
+	void setState(PlayerState newState);
+	/// Frees the extensions added with autoDeleteExt, for when the player
+	/// disconnects
+	void freeExtensions();
+	bool isKicked() const { return this->kicked; }
+
+	IExtension* getExtension(UID id) override;
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override;
+	bool removeExtension(IExtension* extension) override;
+
+	int getID() const override { return this->id; }
+	Vector3 getPosition() const override { return this->position; }
+	void setPosition(Vector3 position) override { this->position = position; }
+	GTAQuat getRotation() const override { return this->rotation; }
+	void setRotation(GTAQuat rotation) override { this->rotation = rotation; }
+	int getVirtualWorld() const override { return this->virtualWorld; }
+	void setVirtualWorld(int vw) override { this->virtualWorld = vw; }
+
+	void kick() override { this->kicked = true; }
+	void ban(StringView reason) override { this->kicked = true; }
+	const PeerNetworkData& getNetworkData() const override
+	{
+		return this->networkData;
+	}
+
+	StringView getName() const override { return this->name; }
+	Colour getColour() const override { return this->colour; }
+	void setColour(Colour colour) override { this->colour = colour; }
+	PlayerState getState() const override { return this->state; }
+
+	void spawn() override;
+	void setSkin(int skin, bool send) override { this->skin = skin; }
+	int getSkin() const override { return this->skin; }
+	void setHealth(float health) override { this->health = health; }
+	float getHealth() const override { return this->health; }
+	void setArmour(float armour) override { this->armour = armour; }
+	float getArmour() const override { return this->armour; }
+	void setInterior(unsigned interior) override { this->interior = interior; }
+	unsigned getInterior() const override { return this->interior; }
+	void setWantedLevel(unsigned level) override { }
+	void setControllable(bool controllable) override { }
+	void setSpectating(bool spectating) override;
+
+	void giveWeapon(WeaponSlotData weapon) override;
+	void resetWeapons() override;
+	void setArmedWeapon(uint32_t weapon) override
+	{
+		this->armedWeapon = weapon;
+	}
+	WeaponSlotData getArmedWeapon() const override;
+
+	void removeFromVehicle(bool force) override;
+
+	void setCameraPosition(Vector3 pos) override { }
+	void setCameraLookAt(Vector3 pos, int cutType) override { }
+	void setCameraBehind() override { }
+	void interpolateCameraPosition(Vector3 from, Vector3 to, int time,
+		PlayerCameraCutType cutType) override
+	{
+	}
+	void interpolateCameraLookAt(Vector3 from, Vector3 to, int time,
+		PlayerCameraCutType cutType) override
+	{
+	}
+
+	void sendClientMessage(const Colour& colour, StringView message) override
+	{
+		this->messages++;
+		this->messageBytes += message.size();
+	}
+	void sendGameText(StringView message, Milliseconds time, int style) override
+	{
+		this->gameTexts++;
+	}
+	void setChatBubble(StringView text, const Colour& colour, float drawDist,
+		Milliseconds expire) override
+	{
+	}
+	void playSound(uint32_t sound, Vector3 pos) override { }
+	void sendDeathMessage(IPlayer& player, IPlayer* killer, int weapon) override
+	{
+	}
+};
+
+/// The players of a server with no network. Connecting, chatting, dying and
+/// the like go through the same event handlers the server would call.
+class PlayerPool final : public IPlayerPool
+{
+	std::vector<std::unique_ptr<Player>> slots;
+	FlatPtrHashSet<IPlayer> connected;
+	FlatPtrHashSet<IPlayer> noBots;
+
+public:
+	DefaultEventDispatcher<PlayerSpawnEventHandler> spawnDispatcher;
+	DefaultEventDispatcher<PlayerConnectEventHandler> connectDispatcher;
+	DefaultEventDispatcher<PlayerTextEventHandler> textDispatcher;
+	DefaultEventDispatcher<PlayerChangeEventHandler> changeDispatcher;
+	DefaultEventDispatcher<PlayerDamageEventHandler> damageDispatcher;
+
+	PlayerPool();
+	~PlayerPool();
+
+	/// nullptr if the server is full
+	Player* connect(const std::string& name);
+	void disconnect(
+		Player& player,
+		PeerDisconnectReason reason = PeerDisconnectReason_Quit);
+	/// Chat message, false if a handler has stopped it
+	bool text(Player& player, StringView message);
+	/// "/name args", false if no handler knew the command
+	bool command(Player& player, StringView command);
+	/// true if the handlers let the player spawn
+	bool requestSpawn(Player& player);
+	void kill(Player& player, Player* killer, int weapon);
+	void damage(Player& player, Player& from, float amount, unsigned weapon,
+		BodyPart part = BodyPart_Torso);
+	void keys(Player& player, uint32_t newKeys, uint32_t oldKeys);
+
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+
+	IPlayer* get(int index) override;
+	Pair<size_t, size_t> bounds() const override
+	{
+		return { 0, this->slots.size() - 1 };
+	}
+
+	const FlatPtrHashSet<IPlayer>& entries() override
+	{
+		return this->connected;
+	}
+	const FlatPtrHashSet<IPlayer>& players() override
+	{
+		return this->connected;
+	}
+	const FlatPtrHashSet<IPlayer>& bots() override { return this->noBots; }
+
+	IEventDispatcher<PlayerSpawnEventHandler>&
+	getPlayerSpawnDispatcher() override
+	{
+		return this->spawnDispatcher;
+	}
+	IEventDispatcher<PlayerConnectEventHandler>&
+	getPlayerConnectDispatcher() override
+	{
+		return this->connectDispatcher;
+	}
+	IEventDispatcher<PlayerTextEventHandler>& getPlayerTextDispatcher() override
+	{
+		return this->textDispatcher;
+	}
+	IEventDispatcher<PlayerChangeEventHandler>&
+	getPlayerChangeDispatcher() override
+	{
+		return this->changeDispatcher;
+	}
+	IEventDispatcher<PlayerDamageEventHandler>&
+	getPlayerDamageDispatcher() override
+	{
+		return this->damageDispatcher;
+	}
+
+	void sendClientMessageToAll(
+		const Colour& colour, StringView message) override;
+	void sendDeathMessageToAll(
+		IPlayer* killer, IPlayer& killee, int weapon) override
+	{
+	}
+};
+}
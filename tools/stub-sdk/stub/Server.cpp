@@ -0,0 +1,62 @@
+#include "Server.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+
+namespace Stub
+{
+Core::Core(PlayerPool& playerPool)
+	: playerPool(playerPool)
+	, lastTick(std::chrono::steady_clock::now())
+{
+}
+
+void Core::tick()
+{
+	auto now = std::chrono::steady_clock::now();
+	auto elapsed = std::chrono::duration_cast<Microseconds>(now - lastTick);
+	this->lastTick = now;
+	this->ticks++;
+	this->dispatcher.dispatch(
+		[&](CoreEventHandler* handler)
+		{
+			handler->onTick(elapsed, now);
+		});
+}
+
+void Core::printLn(const char* fmt, ...)
+{
+	if (!this->verbose)
+		return;
+	va_list args;
+	va_start(args, fmt);
+	std::vprintf(fmt, args);
+	va_end(args);
+	std::putchar('\n');
+}
+
+void Core::setData(SettableCoreDataType type, StringView data)
+{
+	if (type == SettableCoreDataType::ModeText)
+		this->modeText = data.to_string();
+}
+
+Server::Server()
+	: core(players)
+	, dialogs(players)
+	, textDraws(players)
+	, classes(players)
+	, vehicles(players)
+{
+	this->core.getEventDispatcher().addEventHandler(&this->timers);
+	this->components.add(&this->timers);
+	this->components.add(&this->dialogs);
+	this->components.add(&this->classes);
+	this->components.add(&this->vehicles);
+}
+
+Server::~Server()
+{
+	this->core.getEventDispatcher().removeEventHandler(&this->timers);
+}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Components.hpp"
+#include "Player.hpp"
+
+#include <core.hpp>
+#include <sdk.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace Stub
+{
+class Config final : public IConfig
+{
+	std::unordered_map<std::string, bool> bools;
+	std::unordered_map<std::string, int> ints;
+	std::unordered_map<std::string, float> floats;
+
+public:
+	bool* getBool(StringView key) override
+	{
+		return &this->bools[key.to_string()];
+	}
+	int* getInt(StringView key) override
+	{
+		return &this->ints[key.to_string()];
+	}
+	float* getFloat(StringView key) override
+	{
+		return &this->floats[key.to_string()];
+	}
+
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+};
+
+class Core final : public ICore
+{
+	PlayerPool& playerPool;
+	Config config;
+	DefaultEventDispatcher<CoreEventHandler> dispatcher;
+	TimePoint lastTick;
+	unsigned ticks = 0;
+
+public:
+	/// printLn output goes to stdout unless this is off
+	bool verbose = true;
+	std::string modeText;
+
+	explicit Core(PlayerPool& playerPool);
+
+	/// One server tick, the handlers get the time since the previous one
+	void tick();
+
+	IPlayerPool& getPlayers() override { return this->playerPool; }
+	IEventDispatcher<CoreEventHandler>& getEventDispatcher() override
+	{
+		return this->dispatcher;
+	}
+	IConfig& getConfig() override { return this->config; }
+	void printLn(const char* fmt, ...) override;
+	void setData(SettableCoreDataType type, StringView data) override;
+	unsigned getTickCount() const override { return this->ticks; }
+
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+};
+
+class ComponentList final : public IComponentList
+{
+	std::unordered_map<UID, IComponent*> components;
+
+public:
+	void add(IComponent* component)
+	{
+		this->components[component->getUID()] = component;
+	}
+
+	IComponent* queryComponent(UID id) override
+	{
+		auto it = this->components.find(id);
+		return it == this->components.end() ? nullptr : it->second;
+	}
+
+	IExtension* getExtension(UID id) override { return nullptr; }
+	bool addExtension(IExtension* extension, bool autoDeleteExt) override
+	{
+		return false;
+	}
+	bool removeExtension(IExtension* extension) override { return false; }
+};
+
+/// A server with the components the gamemode needs and no network, for
+/// benchmarks and load tests. Players are connected and driven through it,
+/// time only moves on when tick() is called.
+class Server
+{
+public:
+	PlayerPool players;
+	Core core;
+	TimersComponent timers;
+	DialogsComponent dialogs;
+	TextDrawsComponent textDraws;
+	ClassesComponent classes;
+	VehiclesComponent vehicles;
+	ComponentList components;
+
+	Server();
+	~Server();
+
+	void tick() { this->core.tick(); }
+};
+}